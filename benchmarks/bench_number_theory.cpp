@@ -0,0 +1,122 @@
+#include <chrono>  // For std::chrono::steady_clock
+#include <cstdio>  // For printf
+#include <utility> // For std::move
+
+#include "mpa/types.h"         // For u64, usize
+#include "mpa/natural.h"       // For mpa::natural arithmetic
+#include "mpa/number_theory.h" // Number theory function declarations
+
+using mpa::natural::limbs;
+
+// Prevents the compiler from discarding a benchmarked result.
+static volatile mpa::usize g_sink;
+
+static void keep(const limbs &value) {
+  g_sink = value.size();
+}
+
+// Runs `fn` `reps` times and returns the best time per call in milliseconds.
+template <typename Fn>
+static double best_of(int reps, Fn fn) {
+  double best = 1e300;
+  for (int r = 0; r < reps; ++r) {
+    auto start = std::chrono::steady_clock::now();
+    keep(fn());
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    if (elapsed.count() < best) best = elapsed.count();
+  }
+  return best;
+}
+
+static limbs random_limbs(mpa::usize size, mpa::u64 seed) {
+  limbs a(size);
+  mpa::u64 state = seed * 0x9E3779B97F4A7C15ULL + 1;
+  for (auto &limb : a) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    limb = state;
+  }
+  if (!a.empty()) a.back() |= 1ULL << 63;
+  return a;
+}
+
+// Euclid's algorithm, one full division per quotient.
+static limbs naive_gcd(limbs a, limbs b) {
+  while (!b.empty()) {
+    limbs q, r;
+    mpa::natural::divmod(a, b, q, r);
+    a = std::move(b);
+    b = std::move(r);
+  }
+  return a;
+}
+
+// Extended Euclid tracking the first cofactor; its sign alternates, so only
+// magnitudes are kept.
+static limbs naive_gcdext(limbs a, limbs b) {
+  limbs s0 = {1}, s1;
+  while (!b.empty()) {
+    limbs q, r;
+    mpa::natural::divmod(a, b, q, r);
+    limbs s2 = mpa::natural::add(s0, mpa::natural::mul(q, s1));
+    a = std::move(b);
+    b = std::move(r);
+    s0 = std::move(s1);
+    s1 = std::move(s2);
+  }
+  return s0;
+}
+
+// Newton's iteration at full precision from a power of two above the root.
+static limbs naive_root(const limbs &a, mpa::u64 k) {
+  limbs x = mpa::natural::shift_left({1}, (mpa::natural::bit_length(a) + k - 1) / k);
+  for (;;) {
+    limbs q, r;
+    mpa::natural::divmod(a, mpa::natural::pow(x, k - 1), q, r);
+    limbs next = mpa::natural::add(mpa::natural::mul_u64(x, k - 1), q);
+    mpa::natural::divmod(next, {k}, q, r);
+    if (mpa::natural::compare(q, x) >= 0) return x;
+    x = std::move(q);
+  }
+}
+
+static void run(mpa::usize n) {
+  const int reps = n <= 200 ? 5 : 2;
+  limbs a = random_limbs(n, 2 * n + 1);
+  limbs b = random_limbs(n, 3 * n + 2);
+  limbs m = random_limbs(n, 5 * n + 3);
+  m[0] |= 1;
+  limbs u = a;
+  while (mpa::number_theory::gcd(u, m) != limbs{1}) u = mpa::natural::add(u, {1});
+
+  printf("\nn = %zu limbs\n", n);
+  printf("  %-14s %12s %12s %9s\n", "operation", "naive ms", "mpa ms", "speedup");
+
+  auto report = [](const char *name, double naive, double fast) {
+    printf("  %-14s %12.3f %12.3f %8.1fx\n", name, naive, fast, naive / fast);
+  };
+  report("gcd",
+         best_of(reps, [&] { return naive_gcd(a, b); }),
+         best_of(reps, [&] { return mpa::number_theory::gcd(a, b); }));
+  report("gcdext",
+         best_of(reps, [&] { return naive_gcdext(a, b); }),
+         best_of(reps, [&] { return mpa::number_theory::gcdext(a, b).s; }));
+  report("modinv",
+         best_of(reps, [&] { return naive_gcdext(m, u); }),
+         best_of(reps, [&] { return mpa::number_theory::modinv(u, m); }));
+  report("sqrtrem",
+         best_of(reps, [&] { return naive_root(a, 2); }),
+         best_of(reps, [&] { return mpa::number_theory::sqrtrem(a).root; }));
+  report("rootrem k=3",
+         best_of(reps, [&] { return naive_root(a, 3); }),
+         best_of(reps, [&] { return mpa::number_theory::rootrem(a, 3).root; }));
+}
+
+int main() {
+  printf("GCD_HGCD_THRESHOLD = %zu, GCDEXT_HGCD_THRESHOLD = %zu, HGCD_THRESHOLD = %zu limbs\n",
+         mpa::number_theory::GCD_HGCD_THRESHOLD, mpa::number_theory::GCDEXT_HGCD_THRESHOLD,
+         mpa::number_theory::HGCD_THRESHOLD);
+  for (mpa::usize n : {4u, 32u, 96u, 256u, 1024u, 4096u}) {
+    run(n);
+  }
+  return 0;
+}
@@ -0,0 +1,86 @@
+#include <chrono>  // For std::chrono::steady_clock
+#include <cmath>   // For std::ldexp, std::fabs
+#include <cstdio>  // For printf
+#include <vector>  // For std::vector
+
+#include "mpa/types.h" // For f32, f64, usize
+#include "mpa/sum.h"   // Summation function declarations
+
+// Prevents the compiler from discarding a benchmarked result.
+static volatile double g_sink;
+
+template <typename T>
+static void keep(T value) {
+  g_sink = static_cast<double>(value);
+}
+
+// Runs `fn` `reps` times and returns the best time per call in milliseconds.
+template <typename Fn>
+static double best_of(int reps, Fn fn) {
+  double best = 1e300;
+  for (int r = 0; r < reps; ++r) {
+    auto start = std::chrono::steady_clock::now();
+    keep(fn());
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    if (elapsed.count() < best) best = elapsed.count();
+  }
+  return best;
+}
+
+template <typename T>
+static T naive_sum(const T *data, mpa::usize n) {
+  T s = static_cast<T>(0);
+  for (mpa::usize i = 0; i < n; ++i) s += data[i];
+  return s;
+}
+
+template <typename T>
+static T naive_dot(const T *x, const T *y, mpa::usize n) {
+  T s = static_cast<T>(0);
+  for (mpa::usize i = 0; i < n; ++i) s += x[i] * y[i];
+  return s;
+}
+
+template <typename T>
+static void run(const char *type_name, mpa::usize n) {
+  std::vector<T> data(n);
+  mpa::u64 state = 42;
+  for (mpa::usize i = 0; i < n; ++i) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    T mantissa = static_cast<T>(state >> 40) / static_cast<T>(1 << 24);
+    data[i] = std::ldexp((state & 1) ? -mantissa : mantissa, static_cast<int>((state >> 8) % 40) - 20);
+  }
+  const T *p = data.data();
+  const T reference = mpa::sum::exact(p, n);
+  const int reps = 5;
+
+  printf("\n%s, n = %zu\n", type_name, n);
+  printf("  %-20s %12s %14s\n", "kernel", "ms", "|error|");
+
+  auto report = [&](const char *name, double ms, T value) {
+    printf("  %-20s %12.3f %14.6g\n", name, ms, static_cast<double>(std::fabs(value - reference)));
+  };
+  report("naive loop", best_of(reps, [&] { return naive_sum(p, n); }), naive_sum(p, n));
+  report("kahan", best_of(reps, [&] { return mpa::sum::kahan(p, n); }), mpa::sum::kahan(p, n));
+  report("neumaier", best_of(reps, [&] { return mpa::sum::neumaier(p, n); }), mpa::sum::neumaier(p, n));
+  report("pairwise", best_of(reps, [&] { return mpa::sum::pairwise(p, n); }), mpa::sum::pairwise(p, n));
+  report("exact", best_of(reps, [&] { return mpa::sum::exact(p, n); }), reference);
+  report("parallel_pairwise", best_of(reps, [&] { return mpa::sum::parallel_pairwise(p, n); }), mpa::sum::parallel_pairwise(p, n));
+  report("parallel_exact", best_of(reps, [&] { return mpa::sum::parallel_exact(p, n); }), mpa::sum::parallel_exact(p, n));
+
+  const T dot_reference = mpa::sum::exact_dot(p, p, n);
+  auto report_dot = [&](const char *name, double ms, T value) {
+    printf("  %-20s %12.3f %14.6g\n", name, ms, static_cast<double>(std::fabs(value - dot_reference)));
+  };
+  report_dot("naive dot", best_of(reps, [&] { return naive_dot(p, p, n); }), naive_dot(p, p, n));
+  report_dot("exact_dot", best_of(reps, [&] { return mpa::sum::exact_dot(p, p, n); }), dot_reference);
+  report_dot("parallel_exact_dot", best_of(reps, [&] { return mpa::sum::parallel_exact_dot(p, p, n); }), dot_reference);
+}
+
+int main() {
+  for (mpa::usize n : {mpa::usize(1) << 12, mpa::usize(1) << 20, mpa::usize(1) << 24}) {
+    run<mpa::f32>("f32", n);
+    run<mpa::f64>("f64", n);
+  }
+  return 0;
+}
@@ -0,0 +1,230 @@
+#ifndef __MYSTIC_PRECISION_ARM_ASYNC_H__
+#define __MYSTIC_PRECISION_ARM_ASYNC_H__
+
+#include <atomic>     // For std::atomic
+#include <chrono>     // For std::chrono::duration
+#include <functional> // For std::function
+#include <future>     // For std::future
+#include <memory>     // For std::shared_ptr
+#include <mutex>      // For std::mutex, std::lock_guard
+#include <utility>    // For std::move
+
+#if defined(__cpp_impl_coroutine)
+#include <coroutine> // For std::coroutine_handle
+#define __MPA_ASYNC_COROUTINES__
+#endif
+
+#include "mpa/types.h"   // For u32, u64, f64, usize
+#include "mpa/logging.h" // For mpa::LogCallback, mpa::LogLevel
+#include "mpa/natural.h" // For mpa::natural::limbs
+
+namespace mpa {
+namespace async {
+
+// Number of evenly spaced progress messages a job reports by default.
+constexpr u32 DEFAULT_PROGRESS_STEPS = 10;
+
+// Operand size (in limbs) of the largest multiplication, and quotient size
+// of the largest division, a job runs between two cancellation checkpoints.
+// Longer operations are split the way natural::mul and natural::divmod
+// recurse, so the split costs nothing asymptotically.
+constexpr usize CHECKPOINT_LIMBS = 1024;
+
+/**
+ * @brief Per-job settings.
+ * Progress is reported through the logging plumbing: each message is
+ * formatted like MPA_LOG output ("job 3 (powmod): 40%") and passed to
+ * progress_callback, or to the global callback from set_log_callback() when
+ * progress_callback is nullptr. The callback runs on the executor thread.
+ */
+struct options {
+  LogCallback progress_callback = nullptr;
+  LogLevel progress_level = LogLevel::Debug;
+  u32 progress_steps = DEFAULT_PROGRESS_STEPS; // 0 disables progress messages
+};
+
+/**
+ * @brief Constants evaluate() can compute.
+ */
+enum class constant {
+  e,
+  pi
+};
+
+/**
+ * @brief Result of a divide() job: a = quotient * b + remainder.
+ */
+struct divmod_result {
+  natural::limbs quotient;
+  natural::limbs remainder;
+};
+
+namespace detail {
+
+// State shared between a job handle and the executor thread running it.
+struct job_state {
+  u64 id = 0;
+  const char *name = "";
+  options opts;
+  std::atomic<bool> cancelled{false};
+  std::atomic<u64> done{0};
+  std::atomic<u64> total{0};
+
+  // Registers `continuation` to run once the job finishes.
+  // Returns false (without registering) if it has already finished.
+  bool set_continuation(std::function<void()> continuation) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (finished) return false;
+    this->continuation = std::move(continuation);
+    return true;
+  }
+
+  // Marks the job finished and runs the registered continuation, if any.
+  void finish() {
+    std::function<void()> pending;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      finished = true;
+      pending = std::move(continuation);
+    }
+    if (pending) pending();
+  }
+
+private:
+  std::mutex mutex;
+  bool finished = false;
+  std::function<void()> continuation;
+};
+
+} // namespace detail
+
+/**
+ * @brief Handle to a submitted job.
+ * Move-only, like std::future. Dropping a handle does not cancel the job.
+ * When compiled as C++20 the handle is also awaitable with co_await; the
+ * awaiting coroutine resumes on the executor thread that finished the job.
+ * @tparam T The result type.
+ */
+template <typename T>
+class job {
+public:
+  job() = default;
+  job(std::future<T> future, std::shared_ptr<detail::job_state> state)
+    : future(std::move(future)), state(std::move(state)) {}
+
+  /**
+   * @brief Identifier used in progress messages.
+   */
+  u64 id() const { return state->id; }
+
+  /**
+   * @brief Requests cooperative cancellation.
+   * A queued job never starts; a running job stops at its next checkpoint.
+   * Either way get() throws mpa::exception::operation_cancelled. A job that
+   * already finished keeps its result.
+   */
+  void cancel() { state->cancelled.store(true, std::memory_order_relaxed); }
+
+  /**
+   * @brief Fraction of the job's work completed, in [0, 1].
+   * Work is counted in algorithm steps (exponent bits, base-case products,
+   * quotient limbs, series terms), so this is only roughly proportional to
+   * elapsed time. A job that completed successfully always reports 1.
+   */
+  f64 progress() const {
+    const u64 total = state->total.load(std::memory_order_relaxed);
+    if (total == 0) return 0.0;
+    return static_cast<f64>(state->done.load(std::memory_order_relaxed)) / static_cast<f64>(total);
+  }
+
+  /**
+   * @brief Whether the result (or exception) is available.
+   */
+  bool ready() const { return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready; }
+
+  void wait() const { future.wait(); }
+
+  template <typename Rep, typename Period>
+  bool wait_for(const std::chrono::duration<Rep, Period> &timeout) const {
+    return future.wait_for(timeout) == std::future_status::ready;
+  }
+
+  /**
+   * @brief Blocks until the job finishes and returns its result.
+   * May be called once.
+   * @throws mpa::exception::operation_cancelled If the job was cancelled.
+   */
+  T get() { return future.get(); }
+
+#ifdef __MPA_ASYNC_COROUTINES__
+  bool await_ready() const { return ready(); }
+  bool await_suspend(std::coroutine_handle<> handle) {
+    return state->set_continuation([handle] { handle.resume(); });
+  }
+  T await_resume() { return get(); }
+#endif
+
+private:
+  std::future<T> future;
+  std::shared_ptr<detail::job_state> state;
+};
+
+/**
+ * @brief Sets how many jobs the library executor runs at once.
+ * Worker threads are started on demand up to this limit and shared by all
+ * callers, so many concurrent submissions queue instead of oversubscribing
+ * cores. Lowering the limit takes effect as running jobs finish.
+ * @param jobs Maximum concurrent jobs; 0 restores the default of one per
+ * hardware thread.
+ */
+void set_max_concurrency(unsigned jobs);
+
+/**
+ * @brief Current limit on concurrently running jobs.
+ */
+unsigned max_concurrency();
+
+/**
+ * @brief Multiplies a * b on the executor.
+ * Karatsuba recursion (as in natural::mul) down to CHECKPOINT_LIMBS-limb
+ * products, with a checkpoint after each.
+ * @return Handle to a * b.
+ */
+job<natural::limbs> multiply(natural::limbs a, natural::limbs b, const options &opts = options());
+
+/**
+ * @brief Divides a by b on the executor.
+ * Burnikel-Ziegler recursion (as in natural::divmod) down to
+ * CHECKPOINT_LIMBS-limb quotient blocks, with a checkpoint after each block
+ * and inside every large multiplication.
+ * @return Handle to the quotient and remainder.
+ * @throws mpa::exception::division_by_zero If b is zero (on submission).
+ */
+job<divmod_result> divide(natural::limbs a, natural::limbs b, const options &opts = options());
+
+/**
+ * @brief Computes base^exponent mod modulus on the executor.
+ * Left-to-right binary exponentiation with a checkpoint after each exponent
+ * bit and inside every large multiplication and reduction.
+ * @return Handle to the residue in [0, modulus).
+ * @throws mpa::exception::division_by_zero If modulus is zero (on submission).
+ */
+job<natural::limbs> powmod(natural::limbs base, natural::limbs exponent, natural::limbs modulus,
+                           const options &opts = options());
+
+/**
+ * @brief Evaluates a constant to `digits` decimal places on the executor.
+ * Sums a hypergeometric series by binary splitting (e = sum 1 / k!, pi by
+ * the Chudnovsky series, about 14 digits per term) with a checkpoint at
+ * every node and inside every large multiplication, then does one scaling
+ * division (and, for pi, a square root of 10005). The series is summed 20
+ * digits beyond the request, so the result is exact unless the expansion
+ * continues with about 20 zeros.
+ * @return Handle to floor(constant * 10^digits).
+ */
+job<natural::limbs> evaluate(constant c, u64 digits, const options &opts = options());
+
+} // namespace async
+} // namespace mpa
+
+#endif // __MYSTIC_PRECISION_ARM_ASYNC_H__
@@ -61,6 +61,27 @@ public:
     : mpa_logic_error("Invalid Round Mode: " + message) {}
 };
 
+// Specific exception for arguments outside a function's domain.
+class invalid_argument : public mpa_logic_error {
+public:
+  explicit invalid_argument(const std::string& message)
+    : mpa_logic_error("Invalid Argument: " + message) {}
+};
+
+// Specific exception for division (or reduction) by zero.
+class division_by_zero : public mpa_logic_error {
+public:
+  explicit division_by_zero(const std::string& message)
+    : mpa_logic_error("Division By Zero: " + message) {}
+};
+
+// Specific exception for modular inverses that do not exist.
+class not_invertible : public mpa_logic_error {
+public:
+  explicit not_invertible(const std::string& message)
+    : mpa_logic_error("Not Invertible: " + message) {}
+};
+
 // Specific exception for resource not found issues.
 class resource_not_found : public mpa_runtime_error {
 public:
@@ -68,6 +89,13 @@ public:
     : mpa_runtime_error("Resource Not Found: " + message) {}
 };
 
+// Specific exception for work stopped by a cancellation request.
+class operation_cancelled : public mpa_runtime_error {
+public:
+  explicit operation_cancelled(const std::string& message)
+    : mpa_runtime_error("Operation Cancelled: " + message) {}
+};
+
 } // namespace exception
 
 } // namespace mpa
@@ -3,6 +3,7 @@
 
 #include <cstdio>   // For snprintf
 #include <cstdarg>  // For va_list
+#include <atomic>   // For std::atomic
 
 namespace mpa {
 enum class LogLevel {
@@ -17,7 +18,10 @@ enum class LogLevel {
 // User-defined logging callback. Includes file, line, and function name.
 using LogCallback = void(*)(LogLevel level, const char* message, const char* file, int line, const char* func);
 
-static LogCallback s_log_callback = nullptr;
+// Inline (not static) so every translation unit, including the library's own
+// sources, shares the callback installed by set_log_callback(). Atomic as
+// library threads (e.g. the async executor) may log while it is replaced.
+inline std::atomic<LogCallback> s_log_callback{nullptr};
 
 inline void set_log_callback(LogCallback callback) {
   s_log_callback = callback;
@@ -25,9 +29,9 @@ inline void set_log_callback(LogCallback callback) {
 
 // === Internal Logging Implementation ===
 
-// Core function: handles formatting and calls the user callback.
-inline void _internal_log_impl_va(LogLevel level, const char* file, int line, const char* func, const char* format, va_list args) {
-  if (s_log_callback) {
+// Core function: handles formatting and calls `callback` (when set).
+inline void _internal_log_to_va(LogCallback callback, LogLevel level, const char* file, int line, const char* func, const char* format, va_list args) {
+  if (callback) {
     char buffer[1024];
 
 #ifdef _MSC_VER
@@ -36,14 +40,19 @@ inline void _internal_log_impl_va(LogLevel level, const char* file, int line, co
     int written = vsnprintf(buffer, sizeof(buffer), format, args);
 #endif
 
-    if (written < 0 || written >= sizeof(buffer)) {
+    if (written < 0 || written >= static_cast<int>(sizeof(buffer))) {
       buffer[sizeof(buffer) - 1] = '\0';
     }
 
-    s_log_callback(level, buffer, file, line, func);
+    callback(level, buffer, file, line, func);
   }
 }
 
+// Formats and forwards to the global callback.
+inline void _internal_log_impl_va(LogLevel level, const char* file, int line, const char* func, const char* format, va_list args) {
+  _internal_log_to_va(s_log_callback, level, file, line, func, format, args);
+}
+
 // Variadic function called by macros.
 // __attribute__ enables compile-time format string checks (for Clang/GCC).
 inline void _internal_log_impl(LogLevel level, const char* file, int line, const char* func, const char* format, ...)
@@ -56,6 +65,18 @@ inline void _internal_log_impl(LogLevel level, const char* file, int line, const
   va_end(args);
 }
 
+// Variadic function for an explicit callback, used for per-operation
+// reporting such as async job progress.
+inline void _internal_log_to(LogCallback callback, LogLevel level, const char* file, int line, const char* func, const char* format, ...)
+    __attribute__((format(printf, 6, 7)));
+
+inline void _internal_log_to(LogCallback callback, LogLevel level, const char* file, int line, const char* func, const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  _internal_log_to_va(callback, level, file, line, func, format, args);
+  va_end(args);
+}
+
 
 // === Logging Macros ===
 // Capture __FILE__, __LINE__, and __func__ at the call site.
@@ -63,6 +84,9 @@ inline void _internal_log_impl(LogLevel level, const char* file, int line, const
 // MPA_LOG: Allows explicit LogLevel specification.
 #define MPA_LOG(level, format, ...) mpa::_internal_log_impl(level, __FILE__, __LINE__, __func__, format, ##__VA_ARGS__)
 
+// MPA_LOG_TO: Same as MPA_LOG, but reports to `callback` instead of the global one.
+#define MPA_LOG_TO(callback, level, format, ...) mpa::_internal_log_to(callback, level, __FILE__, __LINE__, __func__, format, ##__VA_ARGS__)
+
 // MPA_LOG_*: Pre-defined level macros for common use.
 #define MPA_LOG_TRACE(format, ...) MPA_LOG(mpa::LogLevel::Trace, format, ##__VA_ARGS__)
 #define MPA_LOG_DEBUG(format, ...) MPA_LOG(mpa::LogLevel::Debug, format, ##__VA_ARGS__)
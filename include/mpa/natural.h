@@ -0,0 +1,152 @@
+#ifndef __MYSTIC_PRECISION_ARM_NATURAL_H__
+#define __MYSTIC_PRECISION_ARM_NATURAL_H__
+
+#include <vector> // For std::vector
+
+#include "mpa/types.h" // For u64, usize
+
+namespace mpa {
+namespace natural {
+
+// Arbitrary-precision natural number as little-endian u64 limbs.
+// Values are kept normalized: no most-significant zero limbs, zero is empty.
+using limbs = std::vector<u64>;
+
+// Operand size (in limbs of the smaller factor) from which mul() switches
+// from schoolbook to Karatsuba multiplication.
+constexpr usize MUL_KARATSUBA_THRESHOLD = 32;
+
+// Divisor and quotient size (in limbs) from which divmod() switches from
+// schoolbook (Knuth D) to recursive Burnikel-Ziegler division.
+constexpr usize DIV_DC_THRESHOLD = 48;
+
+/**
+ * @brief Builds a natural number from a single machine word.
+ * @param value The value.
+ * @return The normalized limbs of value.
+ */
+limbs from_u64(u64 value);
+
+/**
+ * @brief Number of significant bits.
+ * @param a The input number.
+ * @return The bit length of a (0 for zero).
+ */
+usize bit_length(const limbs &a);
+
+/**
+ * @brief Three-way comparison.
+ * @param a The first number.
+ * @param b The second number.
+ * @return -1, 0 or 1 as a is less than, equal to or greater than b.
+ */
+int compare(const limbs &a, const limbs &b);
+
+/**
+ * @brief Adds two natural numbers.
+ * @param a The first addend.
+ * @param b The second addend.
+ * @return a + b.
+ */
+limbs add(const limbs &a, const limbs &b);
+
+/**
+ * @brief Subtracts two natural numbers.
+ * @param a The minuend.
+ * @param b The subtrahend.
+ * @return a - b.
+ * @throws mpa::exception::invalid_argument If b > a.
+ */
+limbs sub(const limbs &a, const limbs &b);
+
+/**
+ * @brief Adds a shifted natural number in place: a += b * 2^(64 * offset).
+ * @param a The accumulator.
+ * @param b The addend.
+ * @param offset Limb offset applied to b.
+ */
+void add_to(limbs &a, const limbs &b, usize offset = 0);
+
+/**
+ * @brief Subtracts a shifted natural number in place: a -= b * 2^(64 * offset).
+ * @param a The accumulator.
+ * @param b The subtrahend.
+ * @param offset Limb offset applied to b.
+ * @throws mpa::exception::invalid_argument If the result would be negative.
+ */
+void sub_from(limbs &a, const limbs &b, usize offset = 0);
+
+/**
+ * @brief Multiplies by a single machine word.
+ * @param a The multiplicand.
+ * @param m The multiplier.
+ * @return a * m.
+ */
+limbs mul_u64(const limbs &a, u64 m);
+
+/**
+ * @brief Multiplies two natural numbers.
+ * Uses schoolbook multiplication below MUL_KARATSUBA_THRESHOLD and
+ * Karatsuba above it; unbalanced operands are cut into balanced slices.
+ * @param a The multiplicand.
+ * @param b The multiplier.
+ * @return a * b.
+ */
+limbs mul(const limbs &a, const limbs &b);
+
+/**
+ * @brief Raises a natural number to a machine-word power.
+ * @param base The base.
+ * @param exponent The exponent.
+ * @return base^exponent (1 for exponent 0).
+ */
+limbs pow(const limbs &base, u64 exponent);
+
+/**
+ * @brief Euclidean division.
+ * Uses schoolbook division below DIV_DC_THRESHOLD and recursive
+ * Burnikel-Ziegler division above it.
+ * @param a The dividend.
+ * @param b The divisor.
+ * @param quotient Receives a / b.
+ * @param remainder Receives a % b.
+ * @throws mpa::exception::division_by_zero If b is zero.
+ */
+void divmod(const limbs &a, const limbs &b, limbs &quotient, limbs &remainder);
+
+/**
+ * @brief Multiplies by a power of two.
+ * @param a The input number.
+ * @param bits The shift amount.
+ * @return a * 2^bits.
+ */
+limbs shift_left(const limbs &a, usize bits);
+
+/**
+ * @brief Divides by a power of two, rounding down.
+ * @param a The input number.
+ * @param bits The shift amount.
+ * @return a / 2^bits.
+ */
+limbs shift_right(const limbs &a, usize bits);
+
+/**
+ * @brief The lowest `count` limbs, i.e. a mod 2^(64 * count).
+ * @param a The input number.
+ * @param count Number of limbs to keep.
+ * @return The normalized low part.
+ */
+limbs low_limbs(const limbs &a, usize count);
+
+/**
+ * @brief Drops the lowest `count` limbs, i.e. a / 2^(64 * count).
+ * @param a The input number.
+ * @param count Number of limbs to drop.
+ * @return The high part.
+ */
+limbs high_limbs(const limbs &a, usize count);
+
+} // namespace natural
+} // namespace mpa
+
+#endif // __MYSTIC_PRECISION_ARM_NATURAL_H__
@@ -0,0 +1,106 @@
+#ifndef __MYSTIC_PRECISION_ARM_NUMBER_THEORY_H__
+#define __MYSTIC_PRECISION_ARM_NUMBER_THEORY_H__
+
+#include "mpa/types.h"   // For u64, usize
+#include "mpa/natural.h" // For mpa::natural::limbs
+
+namespace mpa {
+namespace number_theory {
+
+// Operand size (in limbs) from which gcd() switches from Lehmer's algorithm
+// to the recursive half-GCD.
+constexpr usize GCD_HGCD_THRESHOLD = 96;
+
+// Operand size (in limbs) from which gcdext() and modinv() switch from
+// Lehmer's algorithm to the recursive half-GCD.
+constexpr usize GCDEXT_HGCD_THRESHOLD = 128;
+
+// Operand size (in limbs) below which the half-GCD recursion bottoms out in
+// Lehmer steps.
+constexpr usize HGCD_THRESHOLD = 48;
+
+// Operand size (in bits) up to which sqrtrem() uses a direct 128-bit method
+// instead of Zimmermann's recursive square root.
+constexpr usize SQRT_BASECASE_BITS = 128;
+
+// Root size (in bits) up to which rootrem() runs Newton's iteration directly
+// from a floating-point estimate instead of doubling the precision.
+constexpr usize ROOT_BASECASE_BITS = 104;
+
+/**
+ * @brief Result of an extended GCD: a * s + b * t = g.
+ * Cofactors are stored as magnitude and sign.
+ */
+struct gcdext_result {
+  natural::limbs g;
+  natural::limbs s;
+  bool s_negative = false;
+  natural::limbs t;
+  bool t_negative = false;
+};
+
+/**
+ * @brief Result of an integer root: value = root^k + remainder.
+ */
+struct root_result {
+  natural::limbs root;
+  natural::limbs remainder;
+};
+
+/**
+ * @brief Greatest common divisor.
+ * Binary GCD on single limbs, Lehmer's algorithm on medium operands and the
+ * half-GCD (built on natural::mul) from GCD_HGCD_THRESHOLD limbs.
+ * @param a The first number.
+ * @param b The second number.
+ * @return gcd(a, b); gcd(0, 0) is 0.
+ */
+natural::limbs gcd(const natural::limbs &a, const natural::limbs &b);
+
+/**
+ * @brief Extended greatest common divisor.
+ * Same algorithm selection as gcd(), using GCDEXT_HGCD_THRESHOLD.
+ * The cofactors satisfy |s| <= b / g and |t| <= a / g.
+ * @param a The first number.
+ * @param b The second number.
+ * @return g = gcd(a, b) together with s, t such that a * s + b * t = g.
+ */
+gcdext_result gcdext(const natural::limbs &a, const natural::limbs &b);
+
+/**
+ * @brief Modular inverse.
+ * Word-sized moduli use a single-limb extended Euclid; larger moduli use the
+ * Lehmer / half-GCD extended GCD without computing the second cofactor.
+ * @param a The number to invert.
+ * @param m The modulus.
+ * @return x in [0, m) with a * x = 1 (mod m).
+ * @throws mpa::exception::division_by_zero If m is zero.
+ * @throws mpa::exception::not_invertible If gcd(a, m) != 1.
+ */
+natural::limbs modinv(const natural::limbs &a, const natural::limbs &m);
+
+/**
+ * @brief Integer square root with remainder.
+ * Zimmermann's Karatsuba square root above SQRT_BASECASE_BITS, so the cost
+ * is within a constant factor of one division.
+ * @param a The input number.
+ * @return s = floor(sqrt(a)) and r = a - s^2.
+ */
+root_result sqrtrem(const natural::limbs &a);
+
+/**
+ * @brief Integer k-th root with remainder.
+ * k = 2 uses sqrtrem(); other degrees use Newton's iteration with
+ * precision doubling above ROOT_BASECASE_BITS, so the cost is within a
+ * constant factor of the final full-precision step.
+ * @param a The input number.
+ * @param k The root degree.
+ * @return r = floor(a^(1/k)) and a - r^k.
+ * @throws mpa::exception::invalid_argument If k is zero.
+ */
+root_result rootrem(const natural::limbs &a, u64 k);
+
+} // namespace number_theory
+} // namespace mpa
+
+#endif // __MYSTIC_PRECISION_ARM_NUMBER_THEORY_H__
@@ -9,6 +9,22 @@
 namespace mpa {
 namespace round {
 
+/**
+ * @brief Selects a rounding rule by name.
+ * Each enumerator matches the function of the same name below. Kernels that
+ * produce a correctly rounded result (e.g., mpa::sum::exact) apply the rule
+ * at the last mantissa bit instead of at the units digit.
+ */
+enum class mode {
+  nearest,        // Nearest, halfway cases away from zero
+  towards_zero,   // Truncation
+  away_from_zero, // Magnitude rounded up
+  towards_even,   // Nearest, halfway cases to even (IEEE 754 default)
+  towards_odd,    // Nearest, halfway cases to odd
+  ceil,           // Towards +infinity
+  floor           // Towards -infinity
+};
+
 /**
  * @brief Rounds a floating-point number to the nearest integer.
  * Halfway cases (e.g., 2.5) round away from zero.
@@ -0,0 +1,141 @@
+#ifndef __MYSTIC_PRECISION_ARM_SUM_H__
+#define __MYSTIC_PRECISION_ARM_SUM_H__
+
+#include <type_traits> // For std::enable_if, std::is_floating_point
+
+#include "mpa/types.h" // For f32, f64, usize
+#include "mpa/round.h" // For mpa::round::mode
+
+namespace mpa {
+namespace sum {
+
+// Elements per leaf block of the pairwise summation tree.
+// Leaves are summed with vector lanes; blocks are combined recursively.
+constexpr usize PAIRWISE_BLOCK = 128;
+
+// Arrays shorter than this are reduced on the calling thread even when a
+// parallel kernel is requested, as thread start-up would dominate.
+constexpr usize PARALLEL_THRESHOLD = usize(1) << 16;
+
+/**
+ * @brief Sums an array with Kahan compensated summation.
+ * The array is split over fixed vector lanes (NEON on AArch64, a scalar
+ * emulation of the same lanes elsewhere), so results are identical on every
+ * target. The error bound is independent of n to first order.
+ * @tparam T A floating-point type (f32 or f64).
+ * @param data Pointer to the first element.
+ * @param n Number of elements.
+ * @return The compensated sum.
+ */
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, T>::type
+kahan(const T *data, usize n);
+
+/**
+ * @brief Sums an array with Neumaier's improved Kahan summation.
+ * Unlike kahan(), stays accurate when an addend is larger than the running sum.
+ * @tparam T A floating-point type (f32 or f64).
+ * @param data Pointer to the first element.
+ * @param n Number of elements.
+ * @return The compensated sum.
+ */
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, T>::type
+neumaier(const T *data, usize n);
+
+/**
+ * @brief Sums an array with pairwise (cascade) summation.
+ * Error grows as O(log n) instead of O(n) for a naive loop, at nearly naive speed.
+ * @tparam T A floating-point type (f32 or f64).
+ * @param data Pointer to the first element.
+ * @param n Number of elements.
+ * @return The pairwise sum.
+ */
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, T>::type
+pairwise(const T *data, usize n);
+
+/**
+ * @brief Sums an array exactly and rounds the result once.
+ * Every element is accumulated without error into a fixed-point
+ * superaccumulator covering the whole exponent range, so the result is the
+ * correctly rounded exact sum and does not depend on the element order.
+ * An exactly zero sum is returned as +0.
+ * @tparam T A floating-point type (f32 or f64).
+ * @param data Pointer to the first element.
+ * @param n Number of elements.
+ * @param rounding The rounding rule applied to the exact sum.
+ * @return The exact sum rounded to T.
+ * @throws mpa::exception::invalid_round_mode If rounding is not a valid mode.
+ */
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, T>::type
+exact(const T *data, usize n, round::mode rounding = round::mode::towards_even);
+
+/**
+ * @brief Computes the dot product exactly and rounds the result once.
+ * Products are formed exactly (no intermediate rounding or underflow) before
+ * accumulation, so the result is the correctly rounded exact dot product.
+ * @tparam T A floating-point type (f32 or f64).
+ * @param x Pointer to the first element of the first vector.
+ * @param y Pointer to the first element of the second vector.
+ * @param n Number of elements in each vector.
+ * @param rounding The rounding rule applied to the exact dot product.
+ * @return The exact dot product rounded to T.
+ * @throws mpa::exception::invalid_round_mode If rounding is not a valid mode.
+ */
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, T>::type
+exact_dot(const T *x, const T *y, usize n, round::mode rounding = round::mode::towards_even);
+
+/**
+ * @brief Multi-threaded pairwise summation.
+ * Subtrees of the pairwise tree are evaluated on separate threads at the same
+ * split points as pairwise(), so the result is bit-identical to pairwise()
+ * for any thread count.
+ * @tparam T A floating-point type (f32 or f64).
+ * @param data Pointer to the first element.
+ * @param n Number of elements.
+ * @param threads Maximum number of threads; 0 uses the hardware concurrency.
+ * @return The pairwise sum.
+ */
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, T>::type
+parallel_pairwise(const T *data, usize n, unsigned threads = 0);
+
+/**
+ * @brief Multi-threaded exact summation.
+ * Each thread fills its own superaccumulator; merging them is exact, so the
+ * result is bit-identical to exact() for any thread count.
+ * @tparam T A floating-point type (f32 or f64).
+ * @param data Pointer to the first element.
+ * @param n Number of elements.
+ * @param rounding The rounding rule applied to the exact sum.
+ * @param threads Maximum number of threads; 0 uses the hardware concurrency.
+ * @return The exact sum rounded to T.
+ * @throws mpa::exception::invalid_round_mode If rounding is not a valid mode.
+ */
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, T>::type
+parallel_exact(const T *data, usize n, round::mode rounding = round::mode::towards_even, unsigned threads = 0);
+
+/**
+ * @brief Multi-threaded exact dot product.
+ * Bit-identical to exact_dot() for any thread count.
+ * @tparam T A floating-point type (f32 or f64).
+ * @param x Pointer to the first element of the first vector.
+ * @param y Pointer to the first element of the second vector.
+ * @param n Number of elements in each vector.
+ * @param rounding The rounding rule applied to the exact dot product.
+ * @param threads Maximum number of threads; 0 uses the hardware concurrency.
+ * @return The exact dot product rounded to T.
+ * @throws mpa::exception::invalid_round_mode If rounding is not a valid mode.
+ */
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, T>::type
+parallel_exact_dot(const T *x, const T *y, usize n, round::mode rounding = round::mode::towards_even, unsigned threads = 0);
+
+} // namespace sum
+} // namespace mpa
+
+#endif // __MYSTIC_PRECISION_ARM_SUM_H__
@@ -0,0 +1,620 @@
+#include <algorithm>          // For std::max, std::swap
+#include <cmath>              // For std::log10
+#include <condition_variable> // For std::condition_variable
+#include <deque>              // For std::deque
+#include <string>             // For std::to_string
+#include <thread>             // For std::thread
+#include <vector>             // For std::vector
+
+#include "mpa/exceptions.h"    // For mpa::exception::division_by_zero, operation_cancelled
+#include "mpa/logging.h"       // For MPA_LOG_TO, mpa::s_log_callback
+#include "mpa/types.h"         // For u32, u64, usize
+#include "mpa/natural.h"       // For mpa::natural arithmetic
+#include "mpa/number_theory.h" // For mpa::number_theory::sqrtrem
+#include "mpa/async.h"         // Function definations
+
+namespace mpa {
+
+namespace async {
+
+namespace {
+
+using natural::limbs;
+
+// Extra decimal digits the constant series are summed to, so truncation
+// only changes the result when the expansion continues with this many zeros.
+constexpr u64 GUARD_DIGITS = 20;
+
+// Source of job ids, shared by every job kind.
+std::atomic<u64> next_job_id{1};
+
+unsigned default_concurrency() {
+  return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+// === Executor ===
+// A bounded pool shared by every job. Threads are started on demand, never
+// more than the concurrency limit, and a thread only takes a job while fewer
+// than `limit` jobs are running. At exit, queued and running jobs are
+// cancelled and the threads joined.
+
+class executor {
+public:
+  static executor &instance() {
+    static executor pool;
+    return pool;
+  }
+
+  void submit(std::shared_ptr<detail::job_state> state, std::function<void()> task) {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      if (stopping) {
+        // Shutting down (e.g. a continuation submitting from a worker): settle
+        // the future here as cancelled instead of queueing past the drain.
+        lock.unlock();
+        state->cancelled.store(true, std::memory_order_relaxed);
+        task();
+        return;
+      }
+      queue.push_back({std::move(state), std::move(task)});
+      spawn_workers();
+    }
+    ready.notify_one();
+  }
+
+  void set_limit(unsigned jobs) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      limit = (jobs == 0) ? default_concurrency() : jobs;
+      spawn_workers();
+    }
+    ready.notify_all();
+  }
+
+  unsigned get_limit() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return limit;
+  }
+
+  ~executor() {
+    std::deque<entry> pending;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+      for (auto &e : queue) e.state->cancelled.store(true, std::memory_order_relaxed);
+      for (auto &state : running) state->cancelled.store(true, std::memory_order_relaxed);
+      pending.swap(queue);
+    }
+    ready.notify_all();
+    for (auto &worker : workers) worker.join();
+    // Settles the futures of jobs that never started.
+    for (auto &e : pending) e.task();
+  }
+
+private:
+  struct entry {
+    std::shared_ptr<detail::job_state> state;
+    std::function<void()> task;
+  };
+
+  executor() : limit(default_concurrency()) {}
+
+  // Starts threads until every queued job that may run has one. Caller holds the lock.
+  void spawn_workers() {
+    if (stopping) return;
+    while (workers.size() < limit && idle < queue.size()) {
+      workers.emplace_back([this] { work(); });
+      ++idle;
+    }
+  }
+
+  void work() {
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+      ready.wait(lock, [this] { return stopping || (!queue.empty() && running.size() < limit); });
+      if (stopping) return;
+
+      entry e = std::move(queue.front());
+      queue.pop_front();
+      --idle;
+      running.push_back(e.state);
+      lock.unlock();
+
+      e.task();
+
+      lock.lock();
+      running.erase(std::find(running.begin(), running.end(), e.state));
+      ++idle;
+      // A slot freed up; a thread held back by the limit may proceed.
+      ready.notify_one();
+    }
+  }
+
+  std::mutex mutex;
+  std::condition_variable ready;
+  std::deque<entry> queue;
+  std::vector<std::thread> workers;
+  std::vector<std::shared_ptr<detail::job_state>> running;
+  usize idle = 0;
+  unsigned limit;
+  bool stopping = false;
+};
+
+// === Job Context ===
+// Cancellation checkpoints and progress accounting for the running job.
+
+class context {
+public:
+  explicit context(detail::job_state &state) : state(state) {}
+
+  // Declares the amount of work, in arbitrary units, the job will report.
+  void begin(u64 total) {
+    state.total.store(std::max<u64>(total, 1), std::memory_order_relaxed);
+    report("started");
+  }
+
+  // Throws if cancellation was requested.
+  void check() const {
+    if (state.cancelled.load(std::memory_order_relaxed)) {
+      throw exception::operation_cancelled("job " + std::to_string(state.id) + " (" + state.name + ")");
+    }
+  }
+
+  // Records `units` of finished work, logs a message each time another
+  // 1 / progress_steps of the total is reached, then checks for cancellation.
+  void advance(u64 units) {
+    const u64 done = state.done.load(std::memory_order_relaxed) + units;
+    state.done.store(done, std::memory_order_relaxed);
+    const u32 steps = state.opts.progress_steps;
+    if (steps != 0) {
+      const u64 total = state.total.load(std::memory_order_relaxed);
+      const u64 step = static_cast<u64>(static_cast<u128>(std::min(done, total)) * steps / total);
+      if (step > reported) {
+        reported = step;
+        MPA_LOG_TO(callback(), state.opts.progress_level, "job %llu (%s): %u%%",
+                   static_cast<unsigned long long>(state.id), state.name, static_cast<unsigned>(step * 100 / steps));
+      }
+    }
+    check();
+  }
+
+  // Marks all work done, for jobs that finish early (empty operands, trivial
+  // moduli) or whose last steps report no units.
+  void complete() {
+    const u64 total = std::max<u64>(state.total.load(std::memory_order_relaxed), 1);
+    state.total.store(total, std::memory_order_relaxed);
+    state.done.store(total, std::memory_order_relaxed);
+    const u32 steps = state.opts.progress_steps;
+    if (steps != 0 && reported < steps) {
+      reported = steps;
+      MPA_LOG_TO(callback(), state.opts.progress_level, "job %llu (%s): 100%%",
+                 static_cast<unsigned long long>(state.id), state.name);
+    }
+  }
+
+  // Logs a lifecycle event ("started", "finished", "cancelled").
+  void report(const char *event) {
+    if (state.opts.progress_steps == 0) return;
+    MPA_LOG_TO(callback(), state.opts.progress_level, "job %llu (%s): %s",
+               static_cast<unsigned long long>(state.id), state.name, event);
+  }
+
+private:
+  LogCallback callback() const {
+    return state.opts.progress_callback ? state.opts.progress_callback : s_log_callback.load();
+  }
+
+  detail::job_state &state;
+  u64 reported = 0;
+};
+
+// Queues `compute(ctx)` and returns a handle to its result.
+template <typename T, typename Fn>
+job<T> launch(const char *name, const options &opts, Fn compute) {
+  auto state = std::make_shared<detail::job_state>();
+  state->id = next_job_id.fetch_add(1, std::memory_order_relaxed);
+  state->name = name;
+  state->opts = opts;
+
+  auto promise = std::make_shared<std::promise<T>>();
+  job<T> handle(promise->get_future(), state);
+  executor::instance().submit(state, [state, promise, compute = std::move(compute)]() mutable {
+    context ctx(*state);
+    try {
+      ctx.check();
+      T result = compute(ctx);
+      ctx.complete();
+      ctx.report("finished");
+      promise->set_value(std::move(result));
+    } catch (const exception::operation_cancelled &) {
+      ctx.report("cancelled");
+      promise->set_exception(std::current_exception());
+    } catch (...) {
+      promise->set_exception(std::current_exception());
+    }
+    state->finish();
+  });
+  return handle;
+}
+
+// === Computations ===
+
+// Limbs [begin, begin + count) of a.
+limbs slice(const limbs &a, usize begin, usize count) {
+  return natural::low_limbs(natural::high_limbs(a, begin), count);
+}
+
+// Leaves of mul_checkpointed() for operands of nominal sizes nx and ny limbs.
+u64 mul_leaves(usize nx, usize ny) {
+  if (nx < ny) std::swap(nx, ny);
+  if (ny == 0) return 0;
+  if (nx <= CHECKPOINT_LIMBS) return 1;
+  if (nx >= 2 * ny) return (nx / ny) * mul_leaves(ny, ny) + mul_leaves(nx % ny, ny);
+  const usize k = (nx + 1) / 2;
+  const usize ny1 = (ny > k) ? ny - k : 0;
+  return mul_leaves(k, ny - ny1) + mul_leaves(nx - k, ny1) + mul_leaves(k + 1, ny1 ? k + 1 : ny);
+}
+
+// natural::mul's slicing and Karatsuba split, recursing on nominal sizes
+// (x < B^nx, y < B^ny) so the leaf count is known in advance. Leaves of at
+// most CHECKPOINT_LIMBS limbs go to natural::mul and advance the context by
+// `units` each.
+limbs mul_checkpointed(context &ctx, const limbs &x, const limbs &y, usize nx, usize ny, u64 units) {
+  if (nx < ny) return mul_checkpointed(ctx, y, x, ny, nx, units);
+  if (ny == 0) return {};
+  if (nx <= CHECKPOINT_LIMBS) {
+    limbs product = natural::mul(x, y);
+    ctx.advance(units);
+    return product;
+  }
+
+  if (nx >= 2 * ny) {
+    limbs product;
+    for (usize offset = 0; offset < nx; offset += ny) {
+      const usize count = std::min(ny, nx - offset);
+      natural::add_to(product, mul_checkpointed(ctx, slice(x, offset, count), y, count, ny, units), offset);
+    }
+    return product;
+  }
+
+  const usize k = (nx + 1) / 2;
+  const usize ny1 = (ny > k) ? ny - k : 0;
+  const limbs x0 = natural::low_limbs(x, k), x1 = natural::high_limbs(x, k);
+  const limbs y0 = natural::low_limbs(y, k), y1 = natural::high_limbs(y, k);
+  limbs z0 = mul_checkpointed(ctx, x0, y0, k, ny - ny1, units);
+  limbs z2 = mul_checkpointed(ctx, x1, y1, nx - k, ny1, units);
+  limbs z1 = mul_checkpointed(ctx, natural::add(x0, x1), natural::add(y0, y1), k + 1, ny1 ? k + 1 : ny, units);
+  natural::sub_from(z1, z0);
+  natural::sub_from(z1, z2);
+
+  limbs product = std::move(z0);
+  natural::add_to(product, z1, k);
+  natural::add_to(product, z2, 2 * k);
+  return product;
+}
+
+limbs mul_checkpointed(context &ctx, const limbs &x, const limbs &y) {
+  return mul_checkpointed(ctx, x, y, x.size(), y.size(), 0);
+}
+
+// natural::divmod's Burnikel-Ziegler recursion with multiplications through
+// mul_checkpointed(). b must be normalized and a < 2 * B^m * b. Leaves of at
+// most CHECKPOINT_LIMBS quotient limbs go to natural::divmod and advance the
+// context by `units` per quotient limb.
+void divmod_recursive(context &ctx, const limbs &a, const limbs &b, usize m, u64 units, limbs &q, limbs &r) {
+  const usize n = b.size();
+  if (m <= CHECKPOINT_LIMBS || n < natural::DIV_DC_THRESHOLD) {
+    natural::divmod(a, b, q, r);
+    ctx.advance(m * units);
+    return;
+  }
+
+  limbs x = a;
+  bool top = false;
+  if (x.size() >= n + m && natural::compare(natural::high_limbs(x, m), b) >= 0) {
+    natural::sub_from(x, b, m);
+    top = true;
+  }
+
+  const usize k = m / 2;
+  const limbs b1 = natural::high_limbs(b, k);
+  const limbs b0 = natural::low_limbs(b, k);
+
+  limbs q1, r1;
+  divmod_recursive(ctx, natural::high_limbs(x, 2 * k), b1, m - k, units, q1, r1);
+  limbs y = natural::low_limbs(x, 2 * k);
+  natural::add_to(y, r1, 2 * k);
+  limbs t = mul_checkpointed(ctx, q1, b0);
+  while (natural::compare(natural::high_limbs(y, k), t) < 0) { // y < t * B^k
+    natural::sub_from(q1, natural::from_u64(1));
+    natural::add_to(y, b, k);
+  }
+  natural::sub_from(y, t, k);
+
+  limbs q0, r0;
+  divmod_recursive(ctx, natural::high_limbs(y, k), b1, k, units, q0, r0);
+  limbs z = natural::low_limbs(y, k);
+  natural::add_to(z, r0, k);
+  t = mul_checkpointed(ctx, q0, b0);
+  while (natural::compare(z, t) < 0) {
+    natural::sub_from(q0, natural::from_u64(1));
+    natural::add_to(z, b);
+  }
+  natural::sub_from(z, t);
+
+  q = std::move(q0);
+  natural::add_to(q, q1, k);
+  if (top) natural::add_to(q, natural::from_u64(1), m);
+  r = std::move(z);
+}
+
+// Quotient limbs divmod_checkpointed() reports for a / b.
+usize quotient_limbs(const limbs &a, const limbs &b) {
+  const usize n = b.size();
+  const usize u = natural::bit_length(a) + static_cast<usize>(__builtin_clzll(b.back()));
+  const usize size = (u + 63) / 64;
+  return (size > n) ? size - n : 0;
+}
+
+// Divides the normalized dividend from the top in chunks of
+// max(n, CHECKPOINT_LIMBS) quotient limbs, each time prepending the previous
+// remainder, as natural::divmod does with chunks of n limbs.
+void divmod_checkpointed(context &ctx, const limbs &a, const limbs &b, u64 units, limbs &q, limbs &r) {
+  const unsigned shift = static_cast<unsigned>(__builtin_clzll(b.back()));
+  const limbs v = natural::shift_left(b, shift);
+  const limbs u = natural::shift_left(a, shift);
+  const usize n = v.size();
+  q.clear();
+  if (u.size() <= n) {
+    natural::divmod(a, b, q, r);
+    return;
+  }
+
+  const usize chunk = std::max(n, CHECKPOINT_LIMBS);
+  usize position = u.size() - n;
+  r = natural::high_limbs(u, position); // Below B^n <= 2 v
+  while (position > 0) {
+    const usize m = (position - 1) % chunk + 1;
+    position -= m;
+    limbs x = slice(u, position, m);
+    natural::add_to(x, r, m);
+    limbs qi;
+    divmod_recursive(ctx, x, v, m, units, qi, r);
+    natural::add_to(q, qi, position);
+  }
+  r = natural::shift_right(r, shift);
+}
+
+limbs multiply_checkpointed(context &ctx, const limbs &a, const limbs &b) {
+  ctx.begin(mul_leaves(a.size(), b.size()));
+  return mul_checkpointed(ctx, a, b, a.size(), b.size(), 1);
+}
+
+divmod_result divide_checkpointed(context &ctx, const limbs &a, const limbs &b) {
+  ctx.begin(quotient_limbs(a, b));
+  divmod_result result;
+  divmod_checkpointed(ctx, a, b, 1, result.quotient, result.remainder);
+  return result;
+}
+
+limbs reduce(context &ctx, const limbs &a, const limbs &m) {
+  limbs q, r;
+  divmod_checkpointed(ctx, a, m, 0, q, r);
+  return r;
+}
+
+limbs powmod_binary(context &ctx, const limbs &base, const limbs &exponent, const limbs &modulus) {
+  const usize bits = natural::bit_length(exponent);
+  ctx.begin(bits);
+  if (modulus == natural::from_u64(1)) return {};
+
+  const limbs b = reduce(ctx, base, modulus);
+  limbs result = natural::from_u64(1);
+  for (usize i = bits; i-- > 0;) {
+    result = reduce(ctx, mul_checkpointed(ctx, result, result), modulus);
+    if ((exponent[i / 64] >> (i % 64)) & 1) result = reduce(ctx, mul_checkpointed(ctx, result, b), modulus);
+    ctx.advance(1);
+  }
+  return result;
+}
+
+// Binary splitting of sum_{k=1}^{N} a(k) prod_{j=1}^{k} p(j) / q(j) = T / Q.
+// Over (a, b]: P = prod p(j), Q = prod q(j), and
+// T(a, b) = T(a, m) Q(m, b) + P(a, m) T(m, b).
+// Only T carries a sign; P is negative exactly when the series alternates
+// and b - a is odd.
+struct series_node {
+  limbs p;
+  limbs q;
+  limbs t;
+  bool t_negative = false;
+};
+
+struct series {
+  limbs (*p)(u64 j); // |p(j)|
+  limbs (*q)(u64 j);
+  u64 (*a)(u64 j);
+  bool alternating; // p(j) < 0 for every j
+};
+
+// Work units for a node over `terms` terms: every node reports its width
+// once merged, so each recursion level counts about N units.
+u64 splitting_work(u64 terms) {
+  if (terms <= 1) return terms;
+  return terms + splitting_work(terms / 2) + splitting_work(terms - terms / 2);
+}
+
+// x += (y_negative ? -y : y), keeping x as a magnitude and a sign.
+void add_signed(limbs &x, bool &x_negative, const limbs &y, bool y_negative) {
+  if (x_negative == y_negative) {
+    natural::add_to(x, y);
+  } else if (natural::compare(x, y) >= 0) {
+    natural::sub_from(x, y);
+  } else {
+    x = natural::sub(y, x);
+    x_negative = y_negative;
+  }
+  if (x.empty()) x_negative = false;
+}
+
+series_node split(context &ctx, const series &s, u64 a, u64 b) {
+  ctx.check();
+  series_node node;
+  if (b - a == 1) {
+    node.p = s.p(b);
+    node.q = s.q(b);
+    node.t = natural::mul_u64(node.p, s.a(b));
+    node.t_negative = s.alternating;
+  } else {
+    const u64 m = a + (b - a) / 2;
+    series_node left = split(ctx, s, a, m);
+    series_node right = split(ctx, s, m, b);
+    const bool left_p_negative = s.alternating && (m - a) % 2 == 1;
+    node.t = mul_checkpointed(ctx, left.t, right.q);
+    node.t_negative = left.t_negative && !node.t.empty();
+    add_signed(node.t, node.t_negative, mul_checkpointed(ctx, left.p, right.t), left_p_negative != right.t_negative);
+    node.p = mul_checkpointed(ctx, left.p, right.p);
+    node.q = mul_checkpointed(ctx, left.q, right.q);
+  }
+  ctx.advance(b - a);
+  return node;
+}
+
+// floor(sqrt(a)) by Newton's iteration from just above the root, which
+// halving the precision recursively provides (as number_theory::rootrem
+// does), with every large product and quotient checkpointed.
+limbs isqrt_checkpointed(context &ctx, const limbs &a) {
+  const usize bits = natural::bit_length(a);
+  if (bits <= 128 * CHECKPOINT_LIMBS) return number_theory::sqrtrem(a).root;
+
+  const usize h = bits / 4;
+  limbs x = natural::shift_left(natural::add(isqrt_checkpointed(ctx, natural::shift_right(a, 2 * h)), {1}), h);
+  for (;;) {
+    limbs q, r;
+    divmod_checkpointed(ctx, a, x, 0, q, r);
+    limbs next = natural::shift_right(natural::add(x, q), 1);
+    if (natural::compare(next, x) >= 0) return x;
+    x = std::move(next);
+  }
+}
+
+// 10^exponent by repeated squaring.
+limbs power_of_ten(context &ctx, u64 exponent) {
+  limbs result = natural::from_u64(1);
+  limbs square = natural::from_u64(10);
+  for (u64 e = exponent; e != 0; e >>= 1) {
+    if (e & 1) result = mul_checkpointed(ctx, result, square);
+    if (e > 1) square = mul_checkpointed(ctx, square, square);
+  }
+  return result;
+}
+
+limbs one(u64) { return natural::from_u64(1); }
+limbs identity(u64 j) { return natural::from_u64(j); }
+u64 unit(u64) { return 1; }
+
+// Chudnovsky: 1 / pi = 12 / C^(3/2) sum_{k>=0} (-1)^k (6k)! (A + Bk) / ((3k)! k!^3 C^(3k)),
+// with term ratio p(k) / q(k) below.
+constexpr u64 CHUDNOVSKY_A = 13591409;
+constexpr u64 CHUDNOVSKY_B = 545140134;
+constexpr u64 CHUDNOVSKY_C3_OVER_24 = 10939058860032000; // 640320^3 / 24
+constexpr f64 CHUDNOVSKY_DIGITS_PER_TERM = 14.181647462725477; // log10(640320^3 / 1728)
+
+limbs chudnovsky_p(u64 k) { return natural::mul_u64(natural::from_u64((6 * k - 5) * (2 * k - 1)), 6 * k - 1); }
+limbs chudnovsky_q(u64 k) { return natural::mul_u64(natural::mul_u64(natural::from_u64(k * k), k), CHUDNOVSKY_C3_OVER_24); }
+u64 chudnovsky_a(u64 k) { return CHUDNOVSKY_A + CHUDNOVSKY_B * k; }
+
+limbs evaluate_series(context &ctx, constant c, u64 digits) {
+  series s;
+  u64 terms;
+  const f64 target = static_cast<f64>(digits + GUARD_DIGITS);
+  if (c == constant::e) {
+    // e = 1 + T / Q. The tail after N terms is below 2 / (N + 1)!, so stop
+    // once log10(N!) exceeds the target.
+    s = {one, identity, unit, false};
+    f64 log_factorial = 0.0;
+    terms = 1;
+    while (log_factorial <= target + 1.0) log_factorial += std::log10(static_cast<f64>(++terms));
+  } else {
+    // pi = 426880 sqrt(10005) Q / (A Q + T). The terms shrink by a factor
+    // above 10^14 each, so the tail is below 10^-(target + 2) of the sum.
+    s = {chudnovsky_p, chudnovsky_q, chudnovsky_a, true};
+    terms = static_cast<u64>((target + 2.0) / CHUDNOVSKY_DIGITS_PER_TERM) + 2;
+  }
+
+  const u64 splitting = splitting_work(terms);
+  ctx.begin(splitting + terms); // The final division costs about one level.
+  series_node sum = split(ctx, s, 0, terms);
+
+  limbs q, r;
+  if (c == constant::e) {
+    const limbs scale = power_of_ten(ctx, digits);
+    divmod_checkpointed(ctx, mul_checkpointed(ctx, sum.t, scale), sum.q, 0, q, r);
+    natural::add_to(q, scale);
+  } else {
+    // Evaluated to 10^-(digits + GUARD_DIGITS), within 2 units there after
+    // the truncated series, square root and quotient. Subtracting 2 makes it
+    // a lower bound before the guard digits are dropped.
+    // Q and T grow well past the result, so only their top 64 bits beyond
+    // the scale are kept; that moves the quotient by far less than a unit.
+    const limbs scale = power_of_ten(ctx, digits + GUARD_DIGITS);
+    const limbs root = isqrt_checkpointed(ctx, natural::mul_u64(mul_checkpointed(ctx, scale, scale), 10005));
+    const usize kept = natural::bit_length(scale) + 64;
+    const usize drop = (natural::bit_length(sum.q) > kept) ? natural::bit_length(sum.q) - kept : 0;
+    const limbs sum_q = natural::shift_right(sum.q, drop);
+    limbs denominator = natural::mul_u64(sum_q, CHUDNOVSKY_A);
+    bool negative = false;
+    add_signed(denominator, negative, natural::shift_right(sum.t, drop), sum.t_negative);
+    divmod_checkpointed(ctx, natural::mul_u64(mul_checkpointed(ctx, root, sum_q), 426880), denominator, 0, q, r);
+    natural::sub_from(q, natural::from_u64(2));
+    divmod_checkpointed(ctx, limbs(q), natural::pow({10}, GUARD_DIGITS), 0, q, r);
+  }
+  ctx.advance(terms);
+  return q;
+}
+
+} // namespace
+
+void set_max_concurrency(unsigned jobs) {
+  executor::instance().set_limit(jobs);
+}
+
+unsigned max_concurrency() {
+  return executor::instance().get_limit();
+}
+
+job<natural::limbs> multiply(natural::limbs a, natural::limbs b, const options &opts) {
+  return launch<limbs>("multiply", opts, [a = std::move(a), b = std::move(b)](context &ctx) {
+    return multiply_checkpointed(ctx, a, b);
+  });
+}
+
+job<divmod_result> divide(natural::limbs a, natural::limbs b, const options &opts) {
+  if (b.empty()) {
+    throw exception::division_by_zero("async::divide: divisor is zero");
+  }
+  return launch<divmod_result>("divide", opts, [a = std::move(a), b = std::move(b)](context &ctx) {
+    return divide_checkpointed(ctx, a, b);
+  });
+}
+
+job<natural::limbs> powmod(natural::limbs base, natural::limbs exponent, natural::limbs modulus,
+                           const options &opts) {
+  if (modulus.empty()) {
+    throw exception::division_by_zero("async::powmod: modulus is zero");
+  }
+  return launch<limbs>("powmod", opts, [base = std::move(base), exponent = std::move(exponent),
+                                        modulus = std::move(modulus)](context &ctx) {
+    return powmod_binary(ctx, base, exponent, modulus);
+  });
+}
+
+job<natural::limbs> evaluate(constant c, u64 digits, const options &opts) {
+  return launch<limbs>(c == constant::e ? "e" : "pi", opts, [c, digits](context &ctx) {
+    return evaluate_series(ctx, c, digits);
+  });
+}
+
+} // namespace async
+
+} // namespace mpa
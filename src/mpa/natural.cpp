@@ -0,0 +1,380 @@
+#include <algorithm> // For std::min, std::max, std::copy
+#include <utility>   // For std::swap
+
+#include "mpa/exceptions.h" // For mpa::exception::invalid_argument, division_by_zero
+#include "mpa/types.h"      // For u64, u128, usize
+#include "mpa/natural.h"    // Function definations
+
+namespace mpa {
+
+namespace natural {
+
+namespace {
+
+inline void trim(limbs &a) {
+  while (!a.empty() && a.back() == 0) a.pop_back();
+}
+
+// Limbs [offset, offset + count) of a, normalized.
+limbs slice(const limbs &a, usize offset, usize count) {
+  if (offset >= a.size()) return {};
+  limbs r(a.begin() + offset, a.begin() + std::min(a.size(), offset + count));
+  trim(r);
+  return r;
+}
+
+limbs mul_basecase(const limbs &a, const limbs &b) {
+  limbs r(a.size() + b.size(), 0);
+  for (usize i = 0; i < a.size(); ++i) {
+    u64 carry = 0;
+    for (usize j = 0; j < b.size(); ++j) {
+      u128 t = static_cast<u128>(a[i]) * b[j] + r[i + j] + carry;
+      r[i + j] = static_cast<u64>(t);
+      carry = static_cast<u64>(t >> 64);
+    }
+    r[i + b.size()] = carry;
+  }
+  trim(r);
+  return r;
+}
+
+void divmod_u64(const limbs &a, u64 d, limbs &q, limbs &r) {
+  q.assign(a.size(), 0);
+  u64 rem = 0;
+  for (usize i = a.size(); i-- > 0;) {
+    u128 cur = (static_cast<u128>(rem) << 64) | a[i];
+    q[i] = static_cast<u64>(cur / d);
+    rem = static_cast<u64>(cur % d);
+  }
+  trim(q);
+  r = from_u64(rem);
+}
+
+// Knuth, TAOCP Vol. 2, Algorithm 4.3.1 D.
+void divmod_basecase(const limbs &a, const limbs &b, limbs &q, limbs &r) {
+  if (compare(a, b) < 0) {
+    q.clear();
+    r = a;
+    return;
+  }
+  if (b.size() == 1) {
+    divmod_u64(a, b[0], q, r);
+    return;
+  }
+
+  const usize n = b.size();
+  const usize m = a.size() - n;
+  const unsigned shift = static_cast<unsigned>(__builtin_clzll(b.back()));
+  limbs v = shift_left(b, shift);
+  limbs u = shift_left(a, shift);
+  u.resize(a.size() + 1, 0);
+
+  q.assign(m + 1, 0);
+  const u128 base = static_cast<u128>(1) << 64;
+  for (usize j = m + 1; j-- > 0;) {
+    u128 num = (static_cast<u128>(u[j + n]) << 64) | u[j + n - 1];
+    u128 qhat = num / v[n - 1];
+    u128 rhat = num % v[n - 1];
+    while (qhat >= base || qhat * v[n - 2] > ((rhat << 64) | u[j + n - 2])) {
+      --qhat;
+      rhat += v[n - 1];
+      if (rhat >= base) break;
+    }
+
+    // u[j .. j+n] -= qhat * v
+    u64 mul_carry = 0;
+    u64 borrow = 0;
+    for (usize i = 0; i < n; ++i) {
+      u128 p = qhat * v[i] + mul_carry;
+      mul_carry = static_cast<u64>(p >> 64);
+      u64 lo = static_cast<u64>(p);
+      u64 t = u[i + j] - lo;
+      u64 b1 = u[i + j] < lo;
+      u64 t2 = t - borrow;
+      u64 b2 = t < borrow;
+      u[i + j] = t2;
+      borrow = b1 | b2;
+    }
+    u64 top = u[j + n];
+    u64 t = top - mul_carry;
+    u64 b1 = top < mul_carry;
+    u[j + n] = t - borrow;
+    bool negative = b1 | (t < borrow);
+
+    if (negative) {
+      --qhat;
+      u64 carry = 0;
+      for (usize i = 0; i < n; ++i) {
+        u128 s = static_cast<u128>(u[i + j]) + v[i] + carry;
+        u[i + j] = static_cast<u64>(s);
+        carry = static_cast<u64>(s >> 64);
+      }
+      u[j + n] += carry;
+    }
+    q[j] = static_cast<u64>(qhat);
+  }
+  trim(q);
+  u.resize(n);
+  trim(u);
+  r = shift_right(u, shift);
+}
+
+// Burnikel-Ziegler recursive division (Brent & Zimmermann, Modern Computer
+// Arithmetic, Algorithm 1.8). b must be normalized (top bit set) and
+// a < 2 * 2^(64 * m) * b.
+void divmod_recursive(const limbs &a, const limbs &b, usize m, limbs &q, limbs &r) {
+  const usize n = b.size();
+  if (m < DIV_DC_THRESHOLD || n < DIV_DC_THRESHOLD) {
+    divmod_basecase(a, b, q, r);
+    return;
+  }
+
+  // Bring a below 2^(64 * m) * b; at most one subtraction is needed.
+  limbs x = a;
+  bool top = false;
+  if (x.size() >= n + m && compare(high_limbs(x, m), b) >= 0) {
+    sub_from(x, b, m);
+    top = true;
+  }
+
+  const usize k = m / 2;
+  const limbs b1 = high_limbs(b, k);
+  const limbs b0 = low_limbs(b, k);
+
+  // High half of the quotient from the top limbs.
+  limbs q1, r1;
+  divmod_recursive(high_limbs(x, 2 * k), b1, m - k, q1, r1);
+  limbs y = low_limbs(x, 2 * k);
+  add_to(y, r1, 2 * k);
+  limbs t = mul(q1, b0);
+  while (compare(high_limbs(y, k), t) < 0) { // y < t * B^k
+    sub_from(q1, from_u64(1));
+    add_to(y, b, k);
+  }
+  sub_from(y, t, k);
+
+  // Low half of the quotient from the partial remainder.
+  limbs q0, r0;
+  divmod_recursive(high_limbs(y, k), b1, k, q0, r0);
+  limbs z = low_limbs(y, k);
+  add_to(z, r0, k);
+  t = mul(q0, b0);
+  while (compare(z, t) < 0) {
+    sub_from(q0, from_u64(1));
+    add_to(z, b);
+  }
+  sub_from(z, t);
+
+  q = std::move(q0);
+  add_to(q, q1, k);
+  if (top) add_to(q, from_u64(1), m);
+  r = std::move(z);
+}
+
+} // namespace
+
+limbs from_u64(u64 value) {
+  return value ? limbs{value} : limbs{};
+}
+
+usize bit_length(const limbs &a) {
+  if (a.empty()) return 0;
+  return 64 * a.size() - static_cast<usize>(__builtin_clzll(a.back()));
+}
+
+int compare(const limbs &a, const limbs &b) {
+  if (a.size() != b.size()) return a.size() < b.size() ? -1 : 1;
+  for (usize i = a.size(); i-- > 0;) {
+    if (a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
+  }
+  return 0;
+}
+
+limbs add(const limbs &a, const limbs &b) {
+  limbs r = a;
+  add_to(r, b);
+  return r;
+}
+
+limbs sub(const limbs &a, const limbs &b) {
+  limbs r = a;
+  sub_from(r, b);
+  return r;
+}
+
+void add_to(limbs &a, const limbs &b, usize offset) {
+  if (b.empty()) return;
+  if (a.size() < b.size() + offset) a.resize(b.size() + offset, 0);
+  u64 carry = 0;
+  usize i = 0;
+  for (; i < b.size(); ++i) {
+    u128 s = static_cast<u128>(a[i + offset]) + b[i] + carry;
+    a[i + offset] = static_cast<u64>(s);
+    carry = static_cast<u64>(s >> 64);
+  }
+  for (i += offset; carry && i < a.size(); ++i) {
+    carry = (++a[i] == 0);
+  }
+  if (carry) a.push_back(1);
+}
+
+void sub_from(limbs &a, const limbs &b, usize offset) {
+  if (b.empty()) return;
+  if (a.size() < b.size() + offset) {
+    throw exception::invalid_argument("natural::sub_from: subtrahend exceeds minuend");
+  }
+  u64 borrow = 0;
+  usize i = 0;
+  for (; i < b.size(); ++i) {
+    u64 x = a[i + offset];
+    u64 t = x - b[i];
+    u64 b1 = x < b[i];
+    a[i + offset] = t - borrow;
+    borrow = b1 | (t < borrow);
+  }
+  for (i += offset; borrow && i < a.size(); ++i) {
+    borrow = (a[i]-- == 0);
+  }
+  if (borrow) {
+    throw exception::invalid_argument("natural::sub_from: subtrahend exceeds minuend");
+  }
+  trim(a);
+}
+
+limbs mul_u64(const limbs &a, u64 m) {
+  if (a.empty() || m == 0) return {};
+  limbs r(a.size() + 1, 0);
+  u64 carry = 0;
+  for (usize i = 0; i < a.size(); ++i) {
+    u128 t = static_cast<u128>(a[i]) * m + carry;
+    r[i] = static_cast<u64>(t);
+    carry = static_cast<u64>(t >> 64);
+  }
+  r[a.size()] = carry;
+  trim(r);
+  return r;
+}
+
+limbs mul(const limbs &a, const limbs &b) {
+  if (a.empty() || b.empty()) return {};
+  const limbs &x = (a.size() >= b.size()) ? a : b;
+  const limbs &y = (a.size() >= b.size()) ? b : a;
+  if (y.size() == 1) return mul_u64(x, y[0]);
+  if (y.size() < MUL_KARATSUBA_THRESHOLD) return mul_basecase(x, y);
+
+  // Unbalanced: multiply y by balanced slices of x.
+  if (x.size() >= 2 * y.size()) {
+    limbs r;
+    for (usize offset = 0; offset < x.size(); offset += y.size()) {
+      add_to(r, mul(slice(x, offset, y.size()), y), offset);
+    }
+    return r;
+  }
+
+  // Karatsuba: x*y = z2 B^2k + ((x0+x1)(y0+y1) - z0 - z2) B^k + z0
+  const usize k = (x.size() + 1) / 2;
+  limbs x0 = low_limbs(x, k), x1 = high_limbs(x, k);
+  limbs y0 = low_limbs(y, k), y1 = high_limbs(y, k);
+  limbs z0 = mul(x0, y0);
+  limbs z2 = mul(x1, y1);
+  limbs z1 = mul(add(x0, x1), add(y0, y1));
+  sub_from(z1, z0);
+  sub_from(z1, z2);
+
+  limbs r = std::move(z0);
+  add_to(r, z1, k);
+  add_to(r, z2, 2 * k);
+  return r;
+}
+
+limbs pow(const limbs &base, u64 exponent) {
+  limbs result = from_u64(1);
+  limbs square = base;
+  while (exponent) {
+    if (exponent & 1) result = mul(result, square);
+    exponent >>= 1;
+    if (exponent) square = mul(square, square);
+  }
+  return result;
+}
+
+void divmod(const limbs &a, const limbs &b, limbs &quotient, limbs &remainder) {
+  if (b.empty()) {
+    throw exception::division_by_zero("natural::divmod: divisor is zero");
+  }
+  if (compare(a, b) < 0) {
+    quotient.clear();
+    remainder = a;
+    return;
+  }
+  if (b.size() < DIV_DC_THRESHOLD || a.size() - b.size() < DIV_DC_THRESHOLD) {
+    divmod_basecase(a, b, quotient, remainder);
+    return;
+  }
+
+  // Normalize, then divide n-limb chunks of the dividend from the top, each
+  // time prepending the previous remainder.
+  const unsigned shift = static_cast<unsigned>(__builtin_clzll(b.back()));
+  const limbs v = shift_left(b, shift);
+  const limbs u = shift_left(a, shift);
+  const usize n = v.size();
+  const usize m_total = u.size() - n;
+  const usize first = (m_total - 1) % n + 1;
+
+  usize position = m_total - first;
+  limbs q, r;
+  divmod_recursive(high_limbs(u, position), v, first, q, r);
+  while (position > 0) {
+    position -= n;
+    limbs current = slice(u, position, n);
+    add_to(current, r, n);
+    limbs qi;
+    divmod_recursive(current, v, n, qi, r);
+    limbs shifted(n, 0);
+    shifted.insert(shifted.end(), q.begin(), q.end());
+    trim(shifted);
+    add_to(shifted, qi);
+    q = std::move(shifted);
+  }
+  quotient = std::move(q);
+  remainder = shift_right(r, shift);
+}
+
+limbs shift_left(const limbs &a, usize bits) {
+  if (a.empty()) return {};
+  const usize limb_shift = bits / 64;
+  const unsigned bit_shift = static_cast<unsigned>(bits % 64);
+  limbs r(a.size() + limb_shift + 1, 0);
+  for (usize i = 0; i < a.size(); ++i) {
+    r[i + limb_shift] |= a[i] << bit_shift;
+    if (bit_shift) r[i + limb_shift + 1] = a[i] >> (64 - bit_shift);
+  }
+  trim(r);
+  return r;
+}
+
+limbs shift_right(const limbs &a, usize bits) {
+  const usize limb_shift = bits / 64;
+  if (limb_shift >= a.size()) return {};
+  const unsigned bit_shift = static_cast<unsigned>(bits % 64);
+  limbs r(a.size() - limb_shift, 0);
+  for (usize i = 0; i < r.size(); ++i) {
+    r[i] = a[i + limb_shift] >> bit_shift;
+    if (bit_shift && i + limb_shift + 1 < a.size()) r[i] |= a[i + limb_shift + 1] << (64 - bit_shift);
+  }
+  trim(r);
+  return r;
+}
+
+limbs low_limbs(const limbs &a, usize count) {
+  return slice(a, 0, count);
+}
+
+limbs high_limbs(const limbs &a, usize count) {
+  if (count >= a.size()) return {};
+  return limbs(a.begin() + count, a.end());
+}
+
+} // namespace natural
+
+} // namespace mpa
@@ -0,0 +1,524 @@
+#include <algorithm> // For std::max
+#include <cmath>     // For std::sqrt, std::log2, std::exp2
+#include <utility>   // For std::swap, std::move
+
+#include "mpa/exceptions.h"    // For mpa::exception::invalid_argument, division_by_zero, not_invertible
+#include "mpa/types.h"         // For u64, u128, i64, i128, usize
+#include "mpa/natural.h"       // For mpa::natural arithmetic
+#include "mpa/number_theory.h" // Function definations
+
+namespace mpa {
+
+namespace number_theory {
+
+namespace {
+
+using natural::limbs;
+
+// === Reduction Matrices ===
+// A reduction is recorded as a 2x2 matrix M with natural entries and
+// determinant 1 such that (a_in, b_in) = M (a_out, b_out). Each step either
+// replaces a by a - q b (right-multiplying by [1 q; 0 1]) or b by b - q a
+// (right-multiplying by [1 0; q 1]).
+
+struct matrix22 {
+  limbs u00 = {1};
+  limbs u01;
+  limbs u10;
+  limbs u11 = {1};
+
+  bool is_identity() const { return u01.empty() && u10.empty(); }
+};
+
+struct word_matrix {
+  u64 u00 = 1;
+  u64 u01 = 0;
+  u64 u10 = 0;
+  u64 u11 = 1;
+};
+
+// x * p + y * q
+inline limbs combine(const limbs &x, const limbs &p, const limbs &y, const limbs &q) {
+  limbs r = natural::mul(x, p);
+  natural::add_to(r, natural::mul(y, q));
+  return r;
+}
+
+inline limbs combine(const limbs &x, u64 p, const limbs &y, u64 q) {
+  limbs r = natural::mul_u64(x, p);
+  natural::add_to(r, natural::mul_u64(y, q));
+  return r;
+}
+
+// M <- M * R
+void mul_right(matrix22 &M, const matrix22 &R) {
+  matrix22 P;
+  P.u00 = combine(M.u00, R.u00, M.u01, R.u10);
+  P.u01 = combine(M.u00, R.u01, M.u01, R.u11);
+  P.u10 = combine(M.u10, R.u00, M.u11, R.u10);
+  P.u11 = combine(M.u10, R.u01, M.u11, R.u11);
+  M = std::move(P);
+}
+
+void mul_right(matrix22 &M, const word_matrix &W) {
+  matrix22 P;
+  P.u00 = combine(M.u00, W.u00, M.u01, W.u10);
+  P.u01 = combine(M.u00, W.u01, M.u01, W.u11);
+  P.u10 = combine(M.u10, W.u00, M.u11, W.u10);
+  P.u11 = combine(M.u10, W.u01, M.u11, W.u11);
+  M = std::move(P);
+}
+
+// Cofactors of the original first operand in the current (a, b), kept as
+// magnitudes. Reductions never change their signs, which are always
+// opposite: `negative_a` is the sign of a's cofactor.
+struct cofactors {
+  limbs ca = {1};
+  limbs cb;
+  bool negative_a = false;
+
+  // Follows (a, b) <- M^-1 (a, b).
+  void apply(const matrix22 &M) {
+    limbs na = combine(ca, M.u11, cb, M.u01);
+    cb = combine(ca, M.u10, cb, M.u00);
+    ca = std::move(na);
+  }
+
+  void apply(const word_matrix &W) {
+    limbs na = combine(ca, W.u11, cb, W.u01);
+    cb = combine(ca, W.u10, cb, W.u00);
+    ca = std::move(na);
+  }
+};
+
+// === Single-Word Helpers ===
+
+u64 binary_gcd(u64 a, u64 b) {
+  if (a == 0) return b;
+  if (b == 0) return a;
+  const int shift = __builtin_ctzll(a | b);
+  a >>= __builtin_ctzll(a);
+  do {
+    b >>= __builtin_ctzll(b);
+    if (a > b) std::swap(a, b);
+    b -= a;
+  } while (b);
+  return a << shift;
+}
+
+bool modinv_u64(u64 a, u64 m, u64 &inverse) {
+  u64 r0 = m, r1 = a;
+  i128 t0 = 0, t1 = 1;
+  while (r1) {
+    u64 q = r0 / r1;
+    u64 r2 = r0 - q * r1;
+    r0 = r1;
+    r1 = r2;
+    i128 t2 = t0 - static_cast<i128>(q) * t1;
+    t0 = t1;
+    t1 = t2;
+  }
+  if (r0 != 1) return false;
+  if (t0 < 0) t0 += m;
+  inverse = static_cast<u64>(t0);
+  return true;
+}
+
+// 64 bits of a starting at bit `bit`.
+u64 extract_bits(const limbs &a, usize bit) {
+  const usize idx = bit / 64;
+  const unsigned shift = static_cast<unsigned>(bit % 64);
+  u64 r = (idx < a.size()) ? a[idx] >> shift : 0;
+  if (shift && idx + 1 < a.size()) r |= a[idx + 1] << (64 - shift);
+  return r;
+}
+
+// a mod 2^bits
+limbs low_bits(const limbs &a, usize bits) {
+  limbs r = natural::low_limbs(a, (bits + 63) / 64);
+  if (bits % 64 && r.size() == (bits + 63) / 64) {
+    r.back() &= (u64(1) << (bits % 64)) - 1;
+    while (!r.empty() && r.back() == 0) r.pop_back();
+  }
+  return r;
+}
+
+// Lehmer step on the leading words: reduces (a, b) while both stay at or
+// above 2^33 and records the steps in W. Entries of W stay below 2^31, so W
+// is also a valid reduction of any operands whose leading 64 bits are (a, b)
+// and keeps them above 2^32 times the dropped scale (Moller, "On Schonhage's
+// algorithm and subquadratic integer gcd computation", 2008).
+bool hgcd_word(u64 a, u64 b, word_matrix &W) {
+  constexpr u64 limit = u64(1) << 33;
+  if (a < limit || b < limit) return false;
+  for (;;) {
+    if (a >= b) {
+      if (a - b < limit) break;
+      u64 q = a / b, r = a % b;
+      if (r < limit) { --q; r += b; }
+      a = r;
+      W.u01 += q * W.u00;
+      W.u11 += q * W.u10;
+    } else {
+      if (b - a < limit) break;
+      u64 q = b / a, r = b % a;
+      if (r < limit) { --q; r += a; }
+      b = r;
+      W.u00 += q * W.u01;
+      W.u10 += q * W.u11;
+    }
+  }
+  return W.u01 != 0 || W.u10 != 0;
+}
+
+// (a, b) <- W^-1 (a, b)
+void apply_word(limbs &a, limbs &b, const word_matrix &W) {
+  limbs na = natural::mul_u64(a, W.u11);
+  natural::sub_from(na, natural::mul_u64(b, W.u01));
+  limbs nb = natural::mul_u64(b, W.u00);
+  natural::sub_from(nb, natural::mul_u64(a, W.u10));
+  a = std::move(na);
+  b = std::move(nb);
+}
+
+// === Half-GCD ===
+
+// One division step that keeps both operands at or above B^s (B = 2^64).
+// Returns false once |a - b| < B^s, i.e. (a, b) is fully reduced.
+bool subdiv_step(limbs &a, limbs &b, usize s, matrix22 &M) {
+  const bool a_larger = natural::compare(a, b) >= 0;
+  limbs &x = a_larger ? a : b;
+  limbs &y = a_larger ? b : a;
+  if (natural::sub(x, y).size() <= s) return false;
+
+  limbs q, r;
+  natural::divmod(x, y, q, r);
+  if (r.size() <= s) {
+    natural::sub_from(q, natural::from_u64(1));
+    natural::add_to(r, y);
+  }
+  x = std::move(r);
+  if (a_larger) {
+    natural::add_to(M.u01, natural::mul(q, M.u00));
+    natural::add_to(M.u11, natural::mul(q, M.u10));
+  } else {
+    natural::add_to(M.u00, natural::mul(q, M.u01));
+    natural::add_to(M.u10, natural::mul(q, M.u11));
+  }
+  return true;
+}
+
+// Lehmer steps (falling back to division steps) until |a - b| < B^s.
+void hgcd_base(limbs &a, limbs &b, usize s, matrix22 &M) {
+  while (a.size() > s && b.size() > s) {
+    // A word step from bit p keeps both operands above 2^(p + 32).
+    const usize n = std::max(natural::bit_length(a), natural::bit_length(b));
+    if (n >= 64 * s + 32) {
+      const usize p = n - 64;
+      word_matrix W;
+      if (hgcd_word(extract_bits(a, p), extract_bits(b, p), W)) {
+        apply_word(a, b, W);
+        mul_right(M, W);
+        continue;
+      }
+    }
+    if (!subdiv_step(a, b, s, M)) return;
+  }
+}
+
+void hgcd(limbs &a, limbs &b, matrix22 &M);
+
+// Reduces the parts of (a, b) above limb p and lifts the reduction to the
+// full operands: a' = a_hi' B^p + u11 a_lo - u01 b_lo (and likewise for b).
+void hgcd_lift(limbs &a, limbs &b, usize p, matrix22 &M) {
+  limbs ah = natural::high_limbs(a, p);
+  limbs bh = natural::high_limbs(b, p);
+  matrix22 R;
+  hgcd(ah, bh, R);
+  if (R.is_identity()) return;
+
+  const limbs al = natural::low_limbs(a, p);
+  const limbs bl = natural::low_limbs(b, p);
+  limbs na = natural::mul(R.u11, al);
+  natural::add_to(na, ah, p);
+  natural::sub_from(na, natural::mul(R.u01, bl));
+  limbs nb = natural::mul(R.u00, bl);
+  natural::add_to(nb, bh, p);
+  natural::sub_from(nb, natural::mul(R.u10, al));
+  a = std::move(na);
+  b = std::move(nb);
+
+  if (M.is_identity()) {
+    M = std::move(R);
+  } else {
+    mul_right(M, R);
+  }
+}
+
+// Reduces n-limb operands until |a - b| < B^s with s = n/2 + 1, keeping both
+// at or above B^s. Two recursive calls on the high halves each cut about
+// n/4 limbs, giving O(M(n) log n) overall.
+void hgcd(limbs &a, limbs &b, matrix22 &M) {
+  M = matrix22();
+  const usize n = std::max(a.size(), b.size());
+  const usize s = n / 2 + 1;
+  if (a.size() <= s || b.size() <= s) return;
+  if (n < HGCD_THRESHOLD) {
+    hgcd_base(a, b, s, M);
+    return;
+  }
+
+  hgcd_lift(a, b, n / 2, M);
+  if (!subdiv_step(a, b, s, M)) return;
+
+  const usize n2 = std::max(a.size(), b.size());
+  if (n2 > s + 2) {
+    hgcd_lift(a, b, 2 * s - n2 + 1, M);
+  }
+  hgcd_base(a, b, s, M);
+}
+
+// === GCD Driver ===
+
+void swap_operands(limbs &a, limbs &b, cofactors *cof) {
+  std::swap(a, b);
+  if (cof) {
+    std::swap(cof->ca, cof->cb);
+    cof->negative_a = !cof->negative_a;
+  }
+}
+
+// a <- a mod b, with a >= b > 0.
+void euclid_step(limbs &a, limbs &b, cofactors *cof) {
+  limbs q, r;
+  natural::divmod(a, b, q, r);
+  a = std::move(r);
+  if (cof) natural::add_to(cof->ca, natural::mul(q, cof->cb));
+}
+
+// Reduces (a, b) to (gcd, 0), tracking the first operand's cofactor if asked.
+limbs gcd_loop(limbs a, limbs b, usize hgcd_threshold, cofactors *cof) {
+  for (;;) {
+    if (natural::compare(a, b) < 0) swap_operands(a, b, cof);
+    if (b.empty()) return a;
+    if (!cof && a.size() == 1) return natural::from_u64(binary_gcd(a[0], b[0]));
+
+    if (a.size() - b.size() <= 1) {
+      if (a.size() >= hgcd_threshold) {
+        matrix22 M;
+        hgcd(a, b, M);
+        if (!M.is_identity()) {
+          if (cof) cof->apply(M);
+          continue;
+        }
+      } else if (a.size() > 1) {
+        const usize p = natural::bit_length(a) - 64;
+        word_matrix W;
+        if (hgcd_word(extract_bits(a, p), extract_bits(b, p), W)) {
+          apply_word(a, b, W);
+          if (cof) cof->apply(W);
+          continue;
+        }
+      }
+    }
+    euclid_step(a, b, cof);
+  }
+}
+
+// === Square Root ===
+
+u64 isqrt_u128(u128 n) {
+  if (n == 0) return 0;
+  const f64 estimate = std::sqrt(static_cast<f64>(n));
+  u64 s = (estimate >= 18446744073709551615.0) ? ~u64(0) : static_cast<u64>(estimate);
+  if (s == 0) s = 1;
+  const u128 newton = (static_cast<u128>(s) + n / s) / 2;
+  s = (newton > ~u64(0)) ? ~u64(0) : static_cast<u64>(newton);
+  while (static_cast<u128>(s) * s > n) --s;
+  while (s != ~u64(0) && static_cast<u128>(s + 1) * (s + 1) <= n) ++s;
+  return s;
+}
+
+// Zimmermann's Karatsuba square root (Brent & Zimmermann, Modern Computer
+// Arithmetic, Algorithm 1.12), split at bit granularity: with
+// k = (bits + 1) / 4 the high part keeps s' >= 2^(k-1), so a single
+// correction step suffices.
+void sqrtrem_recursive(const limbs &m, limbs &s, limbs &r) {
+  const usize bits = natural::bit_length(m);
+  if (bits <= SQRT_BASECASE_BITS) {
+    u128 v = 0;
+    if (m.size() > 0) v = m[0];
+    if (m.size() > 1) v |= static_cast<u128>(m[1]) << 64;
+    const u64 root = isqrt_u128(v);
+    const u128 rem = v - static_cast<u128>(root) * root;
+    s = natural::from_u64(root);
+    r = natural::from_u64(static_cast<u64>(rem));
+    natural::add_to(r, natural::from_u64(static_cast<u64>(rem >> 64)), 1);
+    return;
+  }
+
+  // m = a3 2^3k + a2 2^2k + a1 2^k + a0
+  const usize k = (bits + 1) / 4;
+  const limbs a1 = low_bits(natural::shift_right(m, k), k);
+  const limbs a0 = low_bits(m, k);
+  limbs s1, r1;
+  sqrtrem_recursive(natural::shift_right(m, 2 * k), s1, r1);
+
+  limbs num = natural::shift_left(r1, k);
+  natural::add_to(num, a1);
+  limbs q, u;
+  natural::divmod(num, natural::shift_left(s1, 1), q, u);
+
+  s = natural::shift_left(s1, k);
+  natural::add_to(s, q);
+  limbs x = natural::shift_left(u, k);
+  natural::add_to(x, a0);
+  const limbs y = natural::mul(q, q);
+  while (natural::compare(x, y) < 0) {
+    natural::add_to(x, natural::shift_left(s, 1));
+    natural::sub_from(x, natural::from_u64(1));
+    natural::sub_from(s, natural::from_u64(1));
+  }
+  natural::sub_from(x, y);
+  r = std::move(x);
+}
+
+// Over-estimate of floor(a^(1/k)) with about 50 correct leading bits.
+limbs root_estimate(const limbs &a, u64 k) {
+  const usize bits = natural::bit_length(a);
+  const usize p = (bits > 64) ? bits - 64 : 0;
+  const f64 top = static_cast<f64>(extract_bits(a, p));
+  const usize root_bits = (bits - 1) / k + 1;
+  const usize scale = (root_bits > 52) ? root_bits - 52 : 0;
+
+  // root / 2^scale = 2^((p + log2(top)) / k - scale), with p / k split
+  // into whole and fractional parts to keep the exponent small.
+  const f64 exponent = static_cast<f64>(static_cast<i64>(p / k) - static_cast<i64>(scale)) +
+                       (static_cast<f64>(p % k) + std::log2(top)) / static_cast<f64>(k);
+  const u64 estimate = static_cast<u64>(std::exp2(exponent) * (1.0 + 1e-9)) + 2;
+  return natural::shift_left(natural::from_u64(estimate), scale);
+}
+
+// Newton from above: x <- ((k-1) x + a / x^(k-1)) / k decreases
+// monotonically from any x >= floor(a^(1/k)) until it reaches it.
+limbs root_newton(const limbs &a, u64 k, limbs x) {
+  const limbs degree = natural::from_u64(k);
+  for (;;) {
+    limbs t, rem;
+    natural::divmod(a, natural::pow(x, k - 1), t, rem);
+    limbs y = natural::mul_u64(x, k - 1);
+    natural::add_to(y, t);
+    limbs next;
+    natural::divmod(y, degree, next, rem);
+    if (natural::compare(next, x) >= 0) return x;
+    x = std::move(next);
+  }
+}
+
+// floor(a^(1/k)) with precision doubling: the root of a / 2^(k h) is
+// correct to about half of the target bits, so scaled by 2^h it leaves
+// Newton only one or two full-precision steps.
+limbs root_recursive(const limbs &a, u64 k) {
+  const usize root_bits = (natural::bit_length(a) - 1) / k + 1;
+  if (root_bits <= ROOT_BASECASE_BITS) return root_newton(a, k, root_estimate(a, k));
+
+  const usize h = (root_bits - natural::bit_length(natural::from_u64(k)) - 2) / 2;
+  limbs x = root_recursive(natural::shift_right(a, k * h), k);
+  natural::add_to(x, natural::from_u64(1));
+  return root_newton(a, k, natural::shift_left(x, h));
+}
+
+} // namespace
+
+natural::limbs gcd(const natural::limbs &a, const natural::limbs &b) {
+  if (a.empty()) return b;
+  if (b.empty()) return a;
+  return gcd_loop(a, b, GCD_HGCD_THRESHOLD, nullptr);
+}
+
+gcdext_result gcdext(const natural::limbs &a, const natural::limbs &b) {
+  gcdext_result result;
+  if (b.empty()) {
+    result.g = a;
+    if (!a.empty()) result.s = natural::from_u64(1);
+    return result;
+  }
+  if (a.empty()) {
+    result.g = b;
+    result.t = natural::from_u64(1);
+    return result;
+  }
+
+  cofactors cof;
+  result.g = gcd_loop(a, b, GCDEXT_HGCD_THRESHOLD, &cof);
+  result.s = std::move(cof.ca);
+  result.s_negative = cof.negative_a && !result.s.empty();
+
+  // t = (g - a s) / b, whose sign is opposite to s.
+  limbs as = natural::mul(a, result.s);
+  limbs numerator;
+  if (result.s_negative || result.s.empty()) {
+    numerator = natural::add(result.g, as);
+  } else {
+    numerator = natural::sub(as, result.g);
+    result.t_negative = true;
+  }
+  limbs remainder;
+  natural::divmod(numerator, b, result.t, remainder);
+  result.t_negative = result.t_negative && !result.t.empty();
+  return result;
+}
+
+natural::limbs modinv(const natural::limbs &a, const natural::limbs &m) {
+  if (m.empty()) {
+    throw exception::division_by_zero("number_theory::modinv: modulus is zero");
+  }
+  if (m.size() == 1 && m[0] == 1) return {};
+
+  limbs q, x;
+  natural::divmod(a, m, q, x);
+  if (m.size() == 1) {
+    u64 inverse;
+    if (!modinv_u64(x.empty() ? 0 : x[0], m[0], inverse)) {
+      throw exception::not_invertible("number_theory::modinv: gcd(a, m) != 1");
+    }
+    return natural::from_u64(inverse);
+  }
+  if (x.empty()) {
+    throw exception::not_invertible("number_theory::modinv: gcd(a, m) != 1");
+  }
+
+  cofactors cof;
+  const limbs g = gcd_loop(x, m, GCDEXT_HGCD_THRESHOLD, &cof);
+  if (g.size() != 1 || g[0] != 1) {
+    throw exception::not_invertible("number_theory::modinv: gcd(a, m) != 1");
+  }
+  if (cof.negative_a && !cof.ca.empty()) return natural::sub(m, cof.ca);
+  return std::move(cof.ca);
+}
+
+root_result sqrtrem(const natural::limbs &a) {
+  root_result result;
+  if (!a.empty()) sqrtrem_recursive(a, result.root, result.remainder);
+  return result;
+}
+
+root_result rootrem(const natural::limbs &a, u64 k) {
+  if (k == 0) {
+    throw exception::invalid_argument("number_theory::rootrem: root degree is zero");
+  }
+  if (a.empty() || k == 1) return {a, {}};
+  if (k == 2) return sqrtrem(a);
+  if (k >= natural::bit_length(a)) return {natural::from_u64(1), natural::sub(a, natural::from_u64(1))};
+
+  limbs x = root_recursive(a, k);
+
+  root_result result;
+  result.remainder = natural::sub(a, natural::pow(x, k));
+  result.root = std::move(x);
+  return result;
+}
+
+} // namespace number_theory
+
+} // namespace mpa
@@ -0,0 +1,607 @@
+#include <algorithm>   // For std::min, std::max
+#include <cmath>       // For std::ldexp, std::isnan
+#include <cstring>     // For std::memcpy
+#include <exception>   // For std::exception_ptr, std::current_exception, std::rethrow_exception
+#include <limits>      // For std::numeric_limits
+#include <thread>      // For std::thread
+#include <type_traits> // For std::enable_if, std::is_floating_point
+#include <vector>      // For std::vector
+
+#include "mpa/architecture.h" // For __MPA_ARM_64_BITS_ARMV8__, __MPA_ARM_64_BITS_ARMV9__
+#include "mpa/exceptions.h"   // For mpa::exception::invalid_round_mode
+#include "mpa/types.h"        // For f32, f64, i64, u64, u128, usize
+#include "mpa/sum.h"          // Function definations
+
+// NEON is only used on AArch64: ARMv7 NEON has no f64 lanes and flushes f32
+// subnormals to zero, which would make results differ from the scalar path.
+#if (defined(__MPA_ARM_64_BITS_ARMV9__) || defined(__MPA_ARM_64_BITS_ARMV8__)) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define __MPA_SUM_NEON__
+#endif
+
+namespace mpa {
+
+namespace sum {
+
+namespace {
+
+// === Vector Lanes ===
+// Kernels below are written once against `lanes<T>`. The portable version
+// emulates the exact lane layout of the NEON version (two q-registers), so
+// both produce bit-identical results.
+
+template <typename T>
+struct lanes {
+  static constexpr usize width = 32 / sizeof(T);
+  T v[width];
+
+  static lanes zero() {
+    lanes r;
+    for (usize i = 0; i < width; ++i) r.v[i] = static_cast<T>(0);
+    return r;
+  }
+
+  static lanes load(const T *p) {
+    lanes r;
+    for (usize i = 0; i < width; ++i) r.v[i] = p[i];
+    return r;
+  }
+
+  void store(T *p) const {
+    for (usize i = 0; i < width; ++i) p[i] = v[i];
+  }
+
+  friend lanes operator+(const lanes &a, const lanes &b) {
+    lanes r;
+    for (usize i = 0; i < width; ++i) r.v[i] = a.v[i] + b.v[i];
+    return r;
+  }
+
+  friend lanes operator-(const lanes &a, const lanes &b) {
+    lanes r;
+    for (usize i = 0; i < width; ++i) r.v[i] = a.v[i] - b.v[i];
+    return r;
+  }
+
+  // Per lane, the operand with the larger magnitude (a on ties).
+  friend lanes larger(const lanes &a, const lanes &b) {
+    lanes r;
+    for (usize i = 0; i < width; ++i) r.v[i] = (std::fabs(a.v[i]) >= std::fabs(b.v[i])) ? a.v[i] : b.v[i];
+    return r;
+  }
+
+  // Per lane, the operand not selected by larger().
+  friend lanes smaller(const lanes &a, const lanes &b) {
+    lanes r;
+    for (usize i = 0; i < width; ++i) r.v[i] = (std::fabs(a.v[i]) >= std::fabs(b.v[i])) ? b.v[i] : a.v[i];
+    return r;
+  }
+};
+
+#ifdef __MPA_SUM_NEON__
+template <>
+struct lanes<f32> {
+  static constexpr usize width = 8;
+  float32x4_t lo, hi;
+
+  static lanes zero() { return {vdupq_n_f32(0.0f), vdupq_n_f32(0.0f)}; }
+  static lanes load(const f32 *p) { return {vld1q_f32(p), vld1q_f32(p + 4)}; }
+  void store(f32 *p) const { vst1q_f32(p, lo); vst1q_f32(p + 4, hi); }
+
+  friend lanes operator+(const lanes &a, const lanes &b) { return {vaddq_f32(a.lo, b.lo), vaddq_f32(a.hi, b.hi)}; }
+  friend lanes operator-(const lanes &a, const lanes &b) { return {vsubq_f32(a.lo, b.lo), vsubq_f32(a.hi, b.hi)}; }
+
+  friend lanes larger(const lanes &a, const lanes &b) {
+    return {vbslq_f32(vcageq_f32(a.lo, b.lo), a.lo, b.lo), vbslq_f32(vcageq_f32(a.hi, b.hi), a.hi, b.hi)};
+  }
+  friend lanes smaller(const lanes &a, const lanes &b) {
+    return {vbslq_f32(vcageq_f32(a.lo, b.lo), b.lo, a.lo), vbslq_f32(vcageq_f32(a.hi, b.hi), b.hi, a.hi)};
+  }
+};
+
+template <>
+struct lanes<f64> {
+  static constexpr usize width = 4;
+  float64x2_t lo, hi;
+
+  static lanes zero() { return {vdupq_n_f64(0.0), vdupq_n_f64(0.0)}; }
+  static lanes load(const f64 *p) { return {vld1q_f64(p), vld1q_f64(p + 2)}; }
+  void store(f64 *p) const { vst1q_f64(p, lo); vst1q_f64(p + 2, hi); }
+
+  friend lanes operator+(const lanes &a, const lanes &b) { return {vaddq_f64(a.lo, b.lo), vaddq_f64(a.hi, b.hi)}; }
+  friend lanes operator-(const lanes &a, const lanes &b) { return {vsubq_f64(a.lo, b.lo), vsubq_f64(a.hi, b.hi)}; }
+
+  friend lanes larger(const lanes &a, const lanes &b) {
+    return {vbslq_f64(vcageq_f64(a.lo, b.lo), a.lo, b.lo), vbslq_f64(vcageq_f64(a.hi, b.hi), a.hi, b.hi)};
+  }
+  friend lanes smaller(const lanes &a, const lanes &b) {
+    return {vbslq_f64(vcageq_f64(a.lo, b.lo), b.lo, a.lo), vbslq_f64(vcageq_f64(a.hi, b.hi), b.hi, a.hi)};
+  }
+};
+#endif // __MPA_SUM_NEON__
+
+// === Scalar Helpers ===
+
+template <typename T>
+inline void kahan_add(T &s, T &c, T x) {
+  T y = x - c;
+  T t = s + y;
+  c = (t - s) - y;
+  s = t;
+}
+
+template <typename T>
+inline void neumaier_add(T &s, T &c, T x) {
+  T t = s + x;
+  if (std::fabs(s) >= std::fabs(x)) {
+    c += (s - t) + x;
+  } else {
+    c += (x - t) + s;
+  }
+  s = t;
+}
+
+// Reduces the lanes of `s` in a fixed tree order.
+template <typename T>
+inline T horizontal_add(const lanes<T> &s) {
+  constexpr usize width = lanes<T>::width;
+  T tmp[width];
+  s.store(tmp);
+  for (usize w = width / 2; w > 0; w /= 2) {
+    for (usize i = 0; i < w; ++i) tmp[i] += tmp[i + w];
+  }
+  return tmp[0];
+}
+
+// === Kernels ===
+
+template <typename T>
+T naive_block(const T *data, usize n) {
+  constexpr usize width = lanes<T>::width;
+  lanes<T> s = lanes<T>::zero();
+  usize i = 0;
+  for (; i + width <= n; i += width) {
+    s = s + lanes<T>::load(data + i);
+  }
+  T tail = static_cast<T>(0);
+  for (; i < n; ++i) tail += data[i];
+  return horizontal_add(s) + tail;
+}
+
+// Split point of the pairwise tree: the left half gets the larger whole
+// number of blocks, so the tree shape depends only on n.
+inline usize pairwise_split(usize n) {
+  usize blocks = (n + PAIRWISE_BLOCK - 1) / PAIRWISE_BLOCK;
+  return (blocks / 2) * PAIRWISE_BLOCK;
+}
+
+template <typename T>
+T pairwise_impl(const T *data, usize n) {
+  if (n <= PAIRWISE_BLOCK) {
+    return naive_block(data, n);
+  }
+  usize left = pairwise_split(n);
+  return pairwise_impl(data, left) + pairwise_impl(data + left, n - left);
+}
+
+template <typename T>
+T parallel_pairwise_impl(const T *data, usize n, unsigned threads) {
+  if (threads <= 1 || n < 2 * PARALLEL_THRESHOLD) {
+    return pairwise_impl(data, n);
+  }
+  usize left = pairwise_split(n);
+  unsigned left_threads = threads / 2;
+  T left_sum = static_cast<T>(0);
+  std::exception_ptr left_error;
+  std::thread worker([&] {
+    try {
+      left_sum = parallel_pairwise_impl(data, left, left_threads);
+    } catch (...) {
+      left_error = std::current_exception();
+    }
+  });
+  T right_sum;
+  try {
+    right_sum = parallel_pairwise_impl(data + left, n - left, threads - left_threads);
+  } catch (...) {
+    worker.join();
+    throw;
+  }
+  worker.join();
+  if (left_error) std::rethrow_exception(left_error);
+  return left_sum + right_sum;
+}
+
+inline unsigned resolve_threads(unsigned threads) {
+  if (threads == 0) {
+    threads = std::thread::hardware_concurrency();
+  }
+  return std::max(threads, 1u);
+}
+
+inline void validate_mode(round::mode rounding) {
+  switch (rounding) {
+    case round::mode::nearest:
+    case round::mode::towards_zero:
+    case round::mode::away_from_zero:
+    case round::mode::towards_even:
+    case round::mode::towards_odd:
+    case round::mode::ceil:
+    case round::mode::floor:
+      return;
+  }
+  throw exception::invalid_round_mode("Unknown mpa::round::mode value " + std::to_string(static_cast<int>(rounding)));
+}
+
+// === Superaccumulator ===
+// A fixed-point number wide enough to hold any f64 and any product of two
+// f64 values (2^-2148 .. 2^2048) plus 64 bits of carry headroom. Each limb
+// stores a signed 32-bit digit in an i64, so carries are resolved lazily.
+
+constexpr int ACC_DIGIT_BITS = 32;
+constexpr int ACC_OFFSET = 2176; // Bit index of 2^0
+constexpr int ACC_LIMBS = 136;
+constexpr u64 ACC_NORMALIZE_EVERY = u64(1) << 29; // Terms between carry passes
+constexpr i64 ACC_DIGIT_MASK = 0xffffffff;
+
+class superaccumulator {
+private:
+  i64 _limbs[ACC_LIMBS] = {};
+  u64 _pending = 0;
+  bool _nan = false;
+  bool _pos_inf = false;
+  bool _neg_inf = false;
+
+  static void normalize(i64 *limbs) {
+    for (int i = 0; i < ACC_LIMBS - 1; ++i) {
+      i64 carry = limbs[i] >> ACC_DIGIT_BITS;
+      limbs[i] &= ACC_DIGIT_MASK;
+      limbs[i + 1] += carry;
+    }
+  }
+
+  // Adds (or subtracts) v * 2^(bit - ACC_OFFSET).
+  void add_u64(int bit, u64 v, bool negative) {
+    if (v == 0) return;
+    int idx = bit / ACC_DIGIT_BITS;
+    u128 t = static_cast<u128>(v) << (bit % ACC_DIGIT_BITS);
+    i64 d0 = static_cast<i64>(static_cast<u32>(t));
+    i64 d1 = static_cast<i64>(static_cast<u32>(t >> 32));
+    i64 d2 = static_cast<i64>(static_cast<u32>(t >> 64));
+    if (negative) {
+      _limbs[idx] -= d0;
+      _limbs[idx + 1] -= d1;
+      _limbs[idx + 2] -= d2;
+    } else {
+      _limbs[idx] += d0;
+      _limbs[idx + 1] += d1;
+      _limbs[idx + 2] += d2;
+    }
+  }
+
+  void add_special(f64 x) {
+    if (std::isnan(x)) {
+      _nan = true;
+    } else if (x > 0.0) {
+      _pos_inf = true;
+    } else {
+      _neg_inf = true;
+    }
+  }
+
+  void term_added() {
+    if (++_pending == ACC_NORMALIZE_EVERY) {
+      normalize(_limbs);
+      _pending = 0;
+    }
+  }
+
+  // Splits a finite f64 into mantissa * 2^exponent. Returns false for inf/NaN.
+  static bool decode(f64 x, u64 &mantissa, int &exponent, bool &negative) {
+    u64 bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    int biased = static_cast<int>((bits >> 52) & 0x7ff);
+    if (biased == 0x7ff) return false;
+    negative = (bits >> 63) != 0;
+    mantissa = bits & ((u64(1) << 52) - 1);
+    if (biased == 0) {
+      exponent = -1074;
+    } else {
+      mantissa |= u64(1) << 52;
+      exponent = biased - 1075;
+    }
+    return true;
+  }
+
+  static u64 extract_bits(const i64 *limbs, int lo, int count) {
+    int idx = lo / ACC_DIGIT_BITS;
+    u128 w = 0;
+    for (int j = 2; j >= 0; --j) {
+      w <<= ACC_DIGIT_BITS;
+      if (idx + j < ACC_LIMBS) w |= static_cast<u128>(static_cast<u64>(limbs[idx + j]));
+    }
+    w >>= lo % ACC_DIGIT_BITS;
+    return static_cast<u64>(w) & ((count >= 64) ? ~u64(0) : ((u64(1) << count) - 1));
+  }
+
+  // True if any bit strictly below index `bit` is set.
+  static bool any_bits_below(const i64 *limbs, int bit) {
+    int idx = bit / ACC_DIGIT_BITS;
+    for (int i = 0; i < idx; ++i) {
+      if (limbs[i] != 0) return true;
+    }
+    i64 mask = (i64(1) << (bit % ACC_DIGIT_BITS)) - 1;
+    return (limbs[idx] & mask) != 0;
+  }
+
+public:
+  void add(f64 x) {
+    u64 mantissa;
+    int exponent;
+    bool negative;
+    if (!decode(x, mantissa, exponent, negative)) {
+      add_special(x);
+      return;
+    }
+    add_u64(exponent + ACC_OFFSET, mantissa, negative);
+    term_added();
+  }
+
+  void add_product(f64 a, f64 b) {
+    u64 ma, mb;
+    int ea, eb;
+    bool na, nb;
+    if (!decode(a, ma, ea, na) || !decode(b, mb, eb, nb)) {
+      add_special(a * b);
+      return;
+    }
+    u128 p = static_cast<u128>(ma) * mb;
+    int bit = ea + eb + ACC_OFFSET;
+    add_u64(bit, static_cast<u64>(p), na != nb);
+    add_u64(bit + 64, static_cast<u64>(p >> 64), na != nb);
+    term_added();
+  }
+
+  void merge(superaccumulator other) {
+    normalize(_limbs);
+    normalize(other._limbs);
+    for (int i = 0; i < ACC_LIMBS; ++i) _limbs[i] += other._limbs[i];
+    normalize(_limbs);
+    _pending = 0;
+    _nan = _nan || other._nan;
+    _pos_inf = _pos_inf || other._pos_inf;
+    _neg_inf = _neg_inf || other._neg_inf;
+  }
+
+  // Rounds the exact accumulated value to T under `rounding`.
+  template <typename T>
+  T result(round::mode rounding) {
+    if (_nan || (_pos_inf && _neg_inf)) return std::numeric_limits<T>::quiet_NaN();
+    if (_pos_inf) return std::numeric_limits<T>::infinity();
+    if (_neg_inf) return -std::numeric_limits<T>::infinity();
+
+    normalize(_limbs);
+    _pending = 0;
+
+    // Work on the magnitude; after normalization the top limb carries the sign.
+    i64 mag[ACC_LIMBS];
+    bool negative = _limbs[ACC_LIMBS - 1] < 0;
+    for (int i = 0; i < ACC_LIMBS; ++i) mag[i] = negative ? -_limbs[i] : _limbs[i];
+    if (negative) normalize(mag);
+
+    int top_limb = ACC_LIMBS - 1;
+    while (top_limb >= 0 && mag[top_limb] == 0) --top_limb;
+    if (top_limb < 0) return static_cast<T>(0);
+
+    int top = top_limb * ACC_DIGIT_BITS + 63 - __builtin_clzll(static_cast<u64>(mag[top_limb]));
+    int exponent = top - ACC_OFFSET;
+
+    // Exponent of the last kept bit, clamped to the subnormal range.
+    constexpr int digits = std::numeric_limits<T>::digits;
+    constexpr int min_exponent = std::numeric_limits<T>::min_exponent - 1;
+    int q = std::max(exponent - digits + 1, min_exponent - digits + 1);
+    int k = q + ACC_OFFSET;
+
+    u64 mantissa = (top >= k) ? extract_bits(mag, k, top - k + 1) : 0;
+    bool round_bit = extract_bits(mag, k - 1, 1) != 0;
+    bool sticky = any_bits_below(mag, k - 1);
+    bool inexact = round_bit || sticky;
+    bool odd = (mantissa & 1) != 0;
+
+    bool increment = false;
+    switch (rounding) {
+      case round::mode::nearest:        increment = round_bit; break;
+      case round::mode::towards_zero:   increment = false; break;
+      case round::mode::away_from_zero: increment = inexact; break;
+      case round::mode::towards_even:   increment = round_bit && (sticky || odd); break;
+      case round::mode::towards_odd:    increment = round_bit && (sticky || !odd); break;
+      case round::mode::ceil:           increment = inexact && !negative; break;
+      case round::mode::floor:          increment = inexact && negative; break;
+      default: validate_mode(rounding);
+    }
+    if (increment) ++mantissa;
+
+    T value;
+    int bits = (mantissa == 0) ? 0 : 64 - __builtin_clzll(mantissa);
+    if (bits + q > std::numeric_limits<T>::max_exponent) {
+      bool to_infinity = rounding != round::mode::towards_zero &&
+                         !(rounding == round::mode::ceil && negative) &&
+                         !(rounding == round::mode::floor && !negative);
+      value = to_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+    } else {
+      value = std::ldexp(static_cast<T>(mantissa), q);
+    }
+    return negative ? -value : value;
+  }
+};
+
+inline void accumulate(superaccumulator &acc, const f32 *data, usize n) {
+  for (usize i = 0; i < n; ++i) acc.add(static_cast<f64>(data[i]));
+}
+
+inline void accumulate(superaccumulator &acc, const f64 *data, usize n) {
+  for (usize i = 0; i < n; ++i) acc.add(data[i]);
+}
+
+// f32 products are exact in f64 (48-bit mantissa, no underflow).
+inline void accumulate_dot(superaccumulator &acc, const f32 *x, const f32 *y, usize n) {
+  for (usize i = 0; i < n; ++i) acc.add(static_cast<f64>(x[i]) * static_cast<f64>(y[i]));
+}
+
+inline void accumulate_dot(superaccumulator &acc, const f64 *x, const f64 *y, usize n) {
+  for (usize i = 0; i < n; ++i) acc.add_product(x[i], y[i]);
+}
+
+// Runs `fill(acc, begin, count)` over contiguous chunks on up to `threads`
+// threads (each given at least PARALLEL_THRESHOLD elements) and merges the results.
+template <typename Fill>
+superaccumulator parallel_accumulate(usize n, unsigned threads, Fill fill) {
+  usize chunks = std::min<usize>(resolve_threads(threads), std::max<usize>(n / PARALLEL_THRESHOLD, 1));
+  std::vector<superaccumulator> partial(chunks);
+  std::vector<std::thread> workers;
+  workers.reserve(chunks - 1);
+  try {
+    for (usize c = 0; c + 1 < chunks; ++c) {
+      usize begin = c * n / chunks;
+      usize end = (c + 1) * n / chunks;
+      workers.emplace_back([&partial, &fill, c, begin, end] { fill(partial[c], begin, end - begin); });
+    }
+  } catch (...) {
+    for (auto &w : workers) w.join();
+    throw;
+  }
+  usize begin = (chunks - 1) * n / chunks;
+  fill(partial[chunks - 1], begin, n - begin);
+  for (auto &w : workers) w.join();
+
+  for (usize c = 1; c < chunks; ++c) partial[0].merge(partial[c]);
+  return partial[0];
+}
+
+} // namespace
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, T>::type
+kahan(const T *data, usize n) {
+  constexpr usize width = lanes<T>::width;
+  lanes<T> s = lanes<T>::zero();
+  lanes<T> c = lanes<T>::zero();
+  usize i = 0;
+  for (; i + width <= n; i += width) {
+    lanes<T> y = lanes<T>::load(data + i) - c;
+    lanes<T> t = s + y;
+    c = (t - s) - y;
+    s = t;
+  }
+
+  T ls[width], lc[width];
+  s.store(ls);
+  c.store(lc);
+  T sum = static_cast<T>(0), comp = static_cast<T>(0);
+  for (usize j = 0; j < width; ++j) {
+    kahan_add(sum, comp, ls[j]);
+    kahan_add(sum, comp, -lc[j]);
+  }
+  for (; i < n; ++i) kahan_add(sum, comp, data[i]);
+  return sum - comp;
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, T>::type
+neumaier(const T *data, usize n) {
+  constexpr usize width = lanes<T>::width;
+  lanes<T> s = lanes<T>::zero();
+  lanes<T> c = lanes<T>::zero();
+  usize i = 0;
+  for (; i + width <= n; i += width) {
+    lanes<T> x = lanes<T>::load(data + i);
+    lanes<T> t = s + x;
+    c = c + ((larger(s, x) - t) + smaller(s, x));
+    s = t;
+  }
+
+  T ls[width], lc[width];
+  s.store(ls);
+  c.store(lc);
+  T sum = static_cast<T>(0), comp = static_cast<T>(0);
+  for (usize j = 0; j < width; ++j) {
+    neumaier_add(sum, comp, ls[j]);
+    comp += lc[j];
+  }
+  for (; i < n; ++i) neumaier_add(sum, comp, data[i]);
+  return sum + comp;
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, T>::type
+pairwise(const T *data, usize n) {
+  return pairwise_impl(data, n);
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, T>::type
+exact(const T *data, usize n, round::mode rounding) {
+  validate_mode(rounding);
+  superaccumulator acc;
+  accumulate(acc, data, n);
+  return acc.result<T>(rounding);
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, T>::type
+exact_dot(const T *x, const T *y, usize n, round::mode rounding) {
+  validate_mode(rounding);
+  superaccumulator acc;
+  accumulate_dot(acc, x, y, n);
+  return acc.result<T>(rounding);
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, T>::type
+parallel_pairwise(const T *data, usize n, unsigned threads) {
+  return parallel_pairwise_impl(data, n, resolve_threads(threads));
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, T>::type
+parallel_exact(const T *data, usize n, round::mode rounding, unsigned threads) {
+  validate_mode(rounding);
+  superaccumulator acc = parallel_accumulate(n, threads, [data](superaccumulator &a, usize begin, usize count) {
+    accumulate(a, data + begin, count);
+  });
+  return acc.result<T>(rounding);
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, T>::type
+parallel_exact_dot(const T *x, const T *y, usize n, round::mode rounding, unsigned threads) {
+  validate_mode(rounding);
+  superaccumulator acc = parallel_accumulate(n, threads, [x, y](superaccumulator &a, usize begin, usize count) {
+    accumulate_dot(a, x + begin, y + begin, count);
+  });
+  return acc.result<T>(rounding);
+}
+
+// Explicitly instantiate for f32 (float)
+template f32 kahan<f32>(const f32 *, usize);
+template f32 neumaier<f32>(const f32 *, usize);
+template f32 pairwise<f32>(const f32 *, usize);
+template f32 exact<f32>(const f32 *, usize, round::mode);
+template f32 exact_dot<f32>(const f32 *, const f32 *, usize, round::mode);
+template f32 parallel_pairwise<f32>(const f32 *, usize, unsigned);
+template f32 parallel_exact<f32>(const f32 *, usize, round::mode, unsigned);
+template f32 parallel_exact_dot<f32>(const f32 *, const f32 *, usize, round::mode, unsigned);
+
+// Explicitly instantiate for f64 (double)
+template f64 kahan<f64>(const f64 *, usize);
+template f64 neumaier<f64>(const f64 *, usize);
+template f64 pairwise<f64>(const f64 *, usize);
+template f64 exact<f64>(const f64 *, usize, round::mode);
+template f64 exact_dot<f64>(const f64 *, const f64 *, usize, round::mode);
+template f64 parallel_pairwise<f64>(const f64 *, usize, unsigned);
+template f64 parallel_exact<f64>(const f64 *, usize, round::mode, unsigned);
+template f64 parallel_exact_dot<f64>(const f64 *, const f64 *, usize, round::mode, unsigned);
+
+} // namespace sum
+
+} // namespace mpa
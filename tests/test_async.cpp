@@ -0,0 +1,304 @@
+#include <atomic>  // For std::atomic
+#include <chrono>  // For std::chrono::milliseconds
+#include <cstring> // For strstr
+#include <mutex>   // For std::mutex, std::lock_guard
+#include <string>  // For std::string
+#include <thread>  // For std::this_thread::sleep_for
+#include <vector>  // For std::vector
+
+#include "gtest/gtest.h"    // The Google Test framework
+#include "mpa/exceptions.h" // For mpa::exception::operation_cancelled, division_by_zero
+#include "mpa/logging.h"    // For mpa::LogLevel, mpa::set_log_callback
+#include "mpa/natural.h"    // For mpa::natural arithmetic
+#include "mpa/async.h"      // Async job function declarations
+#include "mpa/types.h"      // For u64, usize types
+
+using mpa::natural::limbs;
+
+// Deterministic pseudo-random number with exactly `size` limbs.
+static limbs random_limbs(mpa::usize size, mpa::u64 seed) {
+    limbs a(size);
+    mpa::u64 state = seed * 0x9E3779B97F4A7C15ULL + 1;
+    for (auto &limb : a) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        limb = state;
+    }
+    if (!a.empty() && a.back() == 0) a.back() = 1;
+    return a;
+}
+
+static limbs from_decimal(const char *digits) {
+    limbs value;
+    for (const char *c = digits; *c; ++c) {
+        value = mpa::natural::add(mpa::natural::mul_u64(value, 10), mpa::natural::from_u64(*c - '0'));
+    }
+    return value;
+}
+
+// Progress messages received by recording_logger().
+static std::mutex g_messages_mutex;
+static std::vector<std::string> g_messages;
+
+static void recording_logger(mpa::LogLevel, const char *message, const char *, int, const char *) {
+    std::lock_guard<std::mutex> lock(g_messages_mutex);
+    g_messages.push_back(message);
+}
+
+static bool received(const char *text) {
+    std::lock_guard<std::mutex> lock(g_messages_mutex);
+    for (const auto &message : g_messages) {
+        if (strstr(message.c_str(), text)) return true;
+    }
+    return false;
+}
+
+static void clear_messages() {
+    std::lock_guard<std::mutex> lock(g_messages_mutex);
+    g_messages.clear();
+}
+
+// --- Test Cases for mpa::async arithmetic jobs ---
+TEST(AsyncTest, MultiplyMatchesNatural) {
+    for (mpa::usize n : {0u, 1u, 40u, 300u}) {
+        limbs a = random_limbs(n, 1);
+        limbs b = random_limbs(37, 2);
+        mpa::async::job<limbs> job = mpa::async::multiply(a, b);
+        ASSERT_EQ(job.get(), mpa::natural::mul(a, b)) << "n = " << n;
+    }
+}
+
+TEST(AsyncTest, DivideMatchesNatural) {
+    for (mpa::usize n : {1u, 40u, 300u}) {
+        limbs a = random_limbs(n, 3);
+        limbs b = random_limbs(17, 4);
+        limbs q, r;
+        mpa::natural::divmod(a, b, q, r);
+        mpa::async::divmod_result result = mpa::async::divide(a, b).get();
+        ASSERT_EQ(result.quotient, q) << "n = " << n;
+        ASSERT_EQ(result.remainder, r) << "n = " << n;
+    }
+    ASSERT_THROW(mpa::async::divide({5}, {}), mpa::exception::division_by_zero);
+}
+
+TEST(AsyncTest, Powmod) {
+    ASSERT_EQ(mpa::async::powmod({123456789}, {987654321}, {1000000007}).get(), limbs{652541198});
+    ASSERT_EQ(mpa::async::powmod({5}, {}, {7}).get(), limbs{1});
+    ASSERT_TRUE(mpa::async::powmod({5}, {3}, {1}).get().empty());
+    ASSERT_THROW(mpa::async::powmod({5}, {3}, {}), mpa::exception::division_by_zero);
+
+    // Fermat: a^(p-1) = 1 mod p for the Mersenne prime p = 2^521 - 1.
+    limbs p = mpa::natural::sub(mpa::natural::shift_left({1}, 521), {1});
+    limbs a = random_limbs(5, 5);
+    ASSERT_EQ(mpa::async::powmod(a, mpa::natural::sub(p, {1}), p).get(), limbs{1});
+}
+
+TEST(AsyncTest, LargeOperandsMatchNatural) {
+    // Beyond CHECKPOINT_LIMBS, balanced and unbalanced, small and large divisors.
+    const mpa::usize c = mpa::async::CHECKPOINT_LIMBS;
+    for (mpa::usize n : {c + 1, 3 * c, 5 * c + 17}) {
+        for (mpa::usize m : {mpa::usize(3), c / 2, c + 5, n}) {
+            limbs a = random_limbs(n, n + m);
+            limbs b = random_limbs(m, 2 * m + 1);
+            ASSERT_EQ(mpa::async::multiply(a, b).get(), mpa::natural::mul(a, b)) << "n = " << n << ", m = " << m;
+
+            limbs dividend = mpa::natural::add(mpa::natural::mul(a, b), random_limbs(m, 3 * m));
+            limbs q, r;
+            mpa::natural::divmod(dividend, b, q, r);
+            mpa::async::divmod_result result = mpa::async::divide(dividend, b).get();
+            ASSERT_EQ(result.quotient, q) << "n = " << n << ", m = " << m;
+            ASSERT_EQ(result.remainder, r) << "n = " << n << ", m = " << m;
+        }
+    }
+}
+
+// --- Test Cases for mpa::async::evaluate ---
+TEST(AsyncTest, EvaluateConstants) {
+    ASSERT_EQ(mpa::async::evaluate(mpa::async::constant::e, 50).get(),
+              from_decimal("271828182845904523536028747135266249775724709369995"));
+    ASSERT_EQ(mpa::async::evaluate(mpa::async::constant::pi, 50).get(),
+              from_decimal("314159265358979323846264338327950288419716939937510"));
+    ASSERT_EQ(mpa::async::evaluate(mpa::async::constant::pi, 0).get(), limbs{3});
+}
+
+TEST(AsyncTest, EvaluateIsConsistentAcrossPrecisions) {
+    // Truncating a longer expansion must give the shorter one.
+    limbs scale = mpa::natural::pow({10}, 1900);
+    for (mpa::async::constant c : {mpa::async::constant::e, mpa::async::constant::pi}) {
+        limbs low = mpa::async::evaluate(c, 100).get();
+        limbs high = mpa::async::evaluate(c, 2000).get();
+        limbs q, r;
+        mpa::natural::divmod(high, scale, q, r);
+        ASSERT_EQ(q, low);
+    }
+}
+
+TEST(AsyncTest, EvaluatePiToManyDigits) {
+    // Well past the budget for a series gaining one bit per term.
+    mpa::async::job<limbs> job = mpa::async::evaluate(mpa::async::constant::pi, 400000);
+    ASSERT_TRUE(job.wait_for(std::chrono::seconds(30)));
+    limbs q, r;
+    mpa::natural::divmod(job.get(), mpa::natural::pow({10}, 399000), q, r);
+    ASSERT_EQ(q, mpa::async::evaluate(mpa::async::constant::pi, 1000).get());
+}
+
+// --- Test Cases for progress reporting ---
+TEST(AsyncTest, ProgressReportsThroughCallback) {
+    clear_messages();
+    mpa::async::options opts;
+    opts.progress_callback = recording_logger;
+    opts.progress_steps = 4;
+    mpa::async::job<limbs> job = mpa::async::powmod(random_limbs(8, 6), random_limbs(4, 7), random_limbs(8, 8), opts);
+    char prefix[64];
+    snprintf(prefix, sizeof(prefix), "job %llu (powmod): ", static_cast<unsigned long long>(job.id()));
+    job.get();
+
+    ASSERT_DOUBLE_EQ(job.progress(), 1.0);
+    for (const char *event : {"started", "25%", "50%", "75%", "100%", "finished"}) {
+        ASSERT_TRUE(received((std::string(prefix) + event).c_str())) << event;
+    }
+}
+
+TEST(AsyncTest, ProgressFallsBackToGlobalLogger) {
+    clear_messages();
+    mpa::set_log_callback(recording_logger);
+    mpa::async::evaluate(mpa::async::constant::e, 100).get();
+    mpa::set_log_callback(nullptr);
+    ASSERT_TRUE(received("(e): 100%"));
+
+    clear_messages();
+    mpa::async::options quiet;
+    quiet.progress_callback = recording_logger;
+    quiet.progress_steps = 0;
+    mpa::async::evaluate(mpa::async::constant::e, 100, quiet).get();
+    ASSERT_FALSE(received("(e)"));
+}
+
+TEST(AsyncTest, ProgressOfBalancedOperations) {
+    // A single balanced product or quotient still reports intermediate steps.
+    const mpa::usize n = 4 * mpa::async::CHECKPOINT_LIMBS;
+    mpa::async::options opts;
+    opts.progress_callback = recording_logger;
+    opts.progress_steps = 4;
+    limbs a = random_limbs(n, 12);
+    limbs b = random_limbs(n, 13);
+
+    clear_messages();
+    mpa::async::job<limbs> product = mpa::async::multiply(a, b, opts);
+    std::string prefix = "job " + std::to_string(product.id()) + " (multiply): ";
+    limbs ab = product.get();
+    ASSERT_TRUE(received((prefix + "25%").c_str()));
+    ASSERT_TRUE(received((prefix + "50%").c_str()));
+
+    clear_messages();
+    mpa::async::job<mpa::async::divmod_result> quotient = mpa::async::divide(ab, b, opts);
+    prefix = "job " + std::to_string(quotient.id()) + " (divide): ";
+    ASSERT_EQ(quotient.get().quotient, a);
+    ASSERT_TRUE(received((prefix + "25%").c_str()));
+    ASSERT_TRUE(received((prefix + "50%").c_str()));
+}
+
+TEST(AsyncTest, ProgressCompletesForTrivialJobs) {
+    mpa::async::job<limbs> empty = mpa::async::multiply({}, random_limbs(4, 14));
+    ASSERT_TRUE(empty.get().empty());
+    ASSERT_DOUBLE_EQ(empty.progress(), 1.0);
+    mpa::async::job<limbs> unit_modulus = mpa::async::powmod({5}, {3}, {1});
+    ASSERT_TRUE(unit_modulus.get().empty());
+    ASSERT_DOUBLE_EQ(unit_modulus.progress(), 1.0);
+    mpa::async::job<limbs> zero_exponent = mpa::async::powmod({5}, {}, {7});
+    ASSERT_EQ(zero_exponent.get(), limbs{1});
+    ASSERT_DOUBLE_EQ(zero_exponent.progress(), 1.0);
+}
+
+// --- Test Cases for cancellation and the executor ---
+TEST(AsyncTest, JobIdsAreUniqueAcrossKinds) {
+    mpa::async::job<limbs> product = mpa::async::multiply({2}, {3});
+    mpa::async::job<mpa::async::divmod_result> quotient = mpa::async::divide({7}, {2});
+    mpa::async::job<limbs> power = mpa::async::powmod({2}, {5}, {7});
+    mpa::async::job<limbs> constant = mpa::async::evaluate(mpa::async::constant::e, 5);
+    ASSERT_NE(product.id(), quotient.id());
+    ASSERT_NE(product.id(), power.id());
+    ASSERT_NE(product.id(), constant.id());
+    ASSERT_NE(quotient.id(), power.id());
+    ASSERT_NE(quotient.id(), constant.id());
+    ASSERT_NE(power.id(), constant.id());
+}
+
+TEST(AsyncTest, CancelBalancedMultiply) {
+    const mpa::usize n = 64 * mpa::async::CHECKPOINT_LIMBS;
+    mpa::async::job<limbs> job = mpa::async::multiply(random_limbs(n, 15), random_limbs(n, 16));
+    while (job.progress() == 0.0) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    job.cancel();
+    ASSERT_THROW(job.get(), mpa::exception::operation_cancelled);
+    ASSERT_LT(job.progress(), 1.0);
+}
+
+TEST(AsyncTest, CancelRunningJob) {
+    mpa::async::job<limbs> job = mpa::async::evaluate(mpa::async::constant::pi, 10000000);
+    while (job.progress() == 0.0) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    job.cancel();
+    ASSERT_TRUE(job.wait_for(std::chrono::seconds(30)));
+    ASSERT_THROW(job.get(), mpa::exception::operation_cancelled);
+}
+
+TEST(AsyncTest, CancelQueuedJobNeverStarts) {
+    mpa::async::set_max_concurrency(1);
+    ASSERT_EQ(mpa::async::max_concurrency(), 1u);
+    mpa::async::job<limbs> running = mpa::async::evaluate(mpa::async::constant::pi, 10000000);
+    mpa::async::job<limbs> queued = mpa::async::multiply(random_limbs(10, 9), random_limbs(10, 10));
+    queued.cancel();
+    running.cancel();
+    ASSERT_THROW(running.get(), mpa::exception::operation_cancelled);
+    ASSERT_THROW(queued.get(), mpa::exception::operation_cancelled);
+    ASSERT_EQ(queued.progress(), 0.0);
+    mpa::async::set_max_concurrency(0);
+}
+
+TEST(AsyncTest, ManyConcurrentJobs) {
+    mpa::async::set_max_concurrency(2);
+    std::vector<mpa::async::job<limbs>> jobs;
+    for (mpa::u64 i = 0; i < 32; ++i) {
+        jobs.push_back(mpa::async::multiply(random_limbs(50, i), random_limbs(50, i + 100)));
+    }
+    for (mpa::u64 i = 0; i < 32; ++i) {
+        ASSERT_EQ(jobs[i].get(), mpa::natural::mul(random_limbs(50, i), random_limbs(50, i + 100)));
+    }
+    mpa::async::set_max_concurrency(0);
+    ASSERT_GE(mpa::async::max_concurrency(), 1u);
+}
+
+#ifdef __MPA_ASYNC_COROUTINES__
+// Minimal eager coroutine that stores its result.
+struct task {
+    struct promise_type {
+        task get_return_object() { return {}; }
+        std::suspend_never initial_suspend() { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+static std::atomic<bool> g_coroutine_done{false};
+
+static task square_then_double(limbs x, limbs *out) {
+    limbs square = co_await mpa::async::multiply(x, x);
+    *out = co_await mpa::async::multiply(square, mpa::natural::from_u64(2));
+    g_coroutine_done = true;
+}
+
+TEST(AsyncTest, CoAwait) {
+    limbs x = random_limbs(20, 11);
+    limbs result;
+    square_then_double(x, &result);
+    while (!g_coroutine_done) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    ASSERT_EQ(result, mpa::natural::mul_u64(mpa::natural::mul(x, x), 2));
+}
+#endif
+
+// Main function to run all tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,138 @@
+#include <vector> // For std::vector
+
+#include "gtest/gtest.h"    // The Google Test framework
+#include "mpa/exceptions.h" // For mpa::exception::division_by_zero, invalid_argument
+#include "mpa/natural.h"    // Natural number function declarations
+#include "mpa/types.h"      // For u64, usize types
+
+using mpa::natural::limbs;
+
+// Deterministic pseudo-random number with exactly `size` limbs.
+static limbs random_limbs(mpa::usize size, mpa::u64 seed) {
+    limbs a(size);
+    mpa::u64 state = seed * 0x9E3779B97F4A7C15ULL + 1;
+    for (auto &limb : a) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        limb = state;
+    }
+    if (!a.empty() && a.back() == 0) a.back() = 1;
+    return a;
+}
+
+// B^n - 1, i.e. n limbs of all ones.
+static limbs all_ones(mpa::usize n) {
+    return limbs(n, ~mpa::u64(0));
+}
+
+// --- Test Cases for basic arithmetic ---
+TEST(NaturalTest, AddSubCarryPropagation) {
+    limbs a = all_ones(5);
+    limbs one = mpa::natural::from_u64(1);
+    limbs sum = mpa::natural::add(a, one);
+    ASSERT_EQ(sum.size(), 6u);
+    ASSERT_EQ(sum.back(), 1u);
+    ASSERT_EQ(mpa::natural::sub(sum, one), a);
+    ASSERT_TRUE(mpa::natural::sub(a, a).empty());
+}
+
+TEST(NaturalTest, SubUnderflowThrows) {
+    ASSERT_THROW(mpa::natural::sub(mpa::natural::from_u64(1), mpa::natural::from_u64(2)),
+                 mpa::exception::invalid_argument);
+}
+
+TEST(NaturalTest, Shifts) {
+    limbs a = random_limbs(7, 1);
+    for (mpa::usize bits : {0u, 1u, 63u, 64u, 65u, 200u}) {
+        limbs shifted = mpa::natural::shift_left(a, bits);
+        ASSERT_EQ(mpa::natural::bit_length(shifted), mpa::natural::bit_length(a) + bits);
+        ASSERT_EQ(mpa::natural::shift_right(shifted, bits), a);
+    }
+    ASSERT_TRUE(mpa::natural::shift_right(a, 64 * 7).empty());
+}
+
+// --- Test Cases for mpa::natural::mul ---
+TEST(NaturalTest, MulAllOnesSquare) {
+    // (B^n - 1)^2 = B^2n - 2 B^n + 1
+    for (mpa::usize n : {1u, 5u, 31u, 32u, 33u, 100u, 257u}) {
+        limbs a = all_ones(n);
+        limbs expected(2 * n, 0);
+        expected[0] = 1;
+        expected[n] = ~mpa::u64(0) - 1;
+        for (mpa::usize i = n + 1; i < 2 * n; ++i) expected[i] = ~mpa::u64(0);
+        ASSERT_EQ(mpa::natural::mul(a, a), expected) << "n = " << n;
+    }
+}
+
+TEST(NaturalTest, MulIsDistributiveAcrossThresholds) {
+    for (mpa::usize n : {3u, 40u, 97u, 300u}) {
+        for (mpa::usize m : {1u, 2u, 33u, 150u}) {
+            limbs a = random_limbs(n, n);
+            limbs b = random_limbs(m, m + 7);
+            limbs c = random_limbs(m + 3, m + 11);
+            limbs lhs = mpa::natural::mul(a, mpa::natural::add(b, c));
+            limbs rhs = mpa::natural::add(mpa::natural::mul(a, b), mpa::natural::mul(a, c));
+            ASSERT_EQ(lhs, rhs) << "n = " << n << ", m = " << m;
+            ASSERT_EQ(mpa::natural::mul(a, b), mpa::natural::mul(b, a));
+        }
+    }
+}
+
+TEST(NaturalTest, Pow) {
+    limbs three = mpa::natural::from_u64(3);
+    ASSERT_EQ(mpa::natural::pow(three, 0), mpa::natural::from_u64(1));
+    ASSERT_EQ(mpa::natural::pow(three, 40), mpa::natural::from_u64(12157665459056928801ULL));
+    limbs a = random_limbs(9, 3);
+    ASSERT_EQ(mpa::natural::pow(a, 5), mpa::natural::mul(mpa::natural::mul(a, a), mpa::natural::pow(a, 3)));
+}
+
+// --- Test Cases for mpa::natural::divmod ---
+TEST(NaturalTest, DivmodReconstructs) {
+    for (mpa::usize n : {1u, 2u, 10u, 60u, 130u, 400u}) {
+        for (mpa::usize m : {1u, 2u, 3u, 49u, 64u, 200u}) {
+            if (m > n) continue;
+            limbs a = random_limbs(n, 31 * n + m);
+            limbs b = random_limbs(m, 17 * m + n);
+            limbs q, r;
+            mpa::natural::divmod(a, b, q, r);
+            ASSERT_LT(mpa::natural::compare(r, b), 0) << "n = " << n << ", m = " << m;
+            limbs back = mpa::natural::mul(q, b);
+            mpa::natural::add_to(back, r);
+            ASSERT_EQ(back, a) << "n = " << n << ", m = " << m;
+        }
+    }
+}
+
+TEST(NaturalTest, DivmodHardQuotientDigits) {
+    // Divisors with a small top limb and dividends of all ones stress the
+    // quotient-digit correction paths in both the schoolbook and recursive code.
+    for (mpa::usize m : {2u, 50u, 120u}) {
+        limbs b = random_limbs(m, m);
+        b.back() = 1;
+        limbs a = all_ones(3 * m + 5);
+        limbs q, r;
+        mpa::natural::divmod(a, b, q, r);
+        ASSERT_LT(mpa::natural::compare(r, b), 0);
+        limbs back = mpa::natural::mul(q, b);
+        mpa::natural::add_to(back, r);
+        ASSERT_EQ(back, a);
+
+        limbs exact = mpa::natural::mul(a, b);
+        mpa::natural::divmod(exact, b, q, r);
+        ASSERT_EQ(q, a);
+        ASSERT_TRUE(r.empty());
+    }
+}
+
+TEST(NaturalTest, DivmodByZeroThrows) {
+    limbs q, r;
+    ASSERT_THROW(mpa::natural::divmod(mpa::natural::from_u64(5), limbs{}, q, r),
+                 mpa::exception::division_by_zero);
+}
+
+// Main function to run all tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
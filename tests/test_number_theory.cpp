@@ -0,0 +1,215 @@
+#include <utility> // For std::swap
+
+#include "gtest/gtest.h"       // The Google Test framework
+#include "mpa/exceptions.h"    // For mpa::exception::not_invertible, division_by_zero, invalid_argument
+#include "mpa/natural.h"       // For mpa::natural arithmetic
+#include "mpa/number_theory.h" // Number theory function declarations
+#include "mpa/types.h"         // For u64, usize types
+
+using mpa::natural::limbs;
+
+// Deterministic pseudo-random number with exactly `size` limbs.
+static limbs random_limbs(mpa::usize size, mpa::u64 seed) {
+    limbs a(size);
+    mpa::u64 state = seed * 0x9E3779B97F4A7C15ULL + 1;
+    for (auto &limb : a) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        limb = state;
+    }
+    if (!a.empty() && a.back() == 0) a.back() = 1;
+    return a;
+}
+
+// Quadratic Euclid, used as the reference.
+static limbs euclid_gcd(limbs a, limbs b) {
+    while (!b.empty()) {
+        limbs q, r;
+        mpa::natural::divmod(a, b, q, r);
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+static limbs mod(const limbs &a, const limbs &m) {
+    limbs q, r;
+    mpa::natural::divmod(a, m, q, r);
+    return r;
+}
+
+// Sizes on both sides of the Lehmer / half-GCD crossovers.
+static const mpa::usize GCD_SIZES[] = {1, 2, 5, 40, 100, 150, 300};
+
+// --- Test Cases for mpa::number_theory::gcd ---
+TEST(NumberTheoryTest, GcdSmallValues) {
+    ASSERT_TRUE(mpa::number_theory::gcd({}, {}).empty());
+    ASSERT_EQ(mpa::number_theory::gcd({}, {12}), limbs{12});
+    ASSERT_EQ(mpa::number_theory::gcd({12}, {}), limbs{12});
+    ASSERT_EQ(mpa::number_theory::gcd({12}, {18}), limbs{6});
+    ASSERT_EQ(mpa::number_theory::gcd({1ULL << 40}, {3ULL << 20}), limbs{1ULL << 20});
+}
+
+TEST(NumberTheoryTest, GcdMatchesEuclid) {
+    for (mpa::usize n : GCD_SIZES) {
+        limbs common = random_limbs(n / 3 + 1, n);
+        limbs a = mpa::natural::mul(random_limbs(n, 2 * n + 1), common);
+        limbs b = mpa::natural::mul(random_limbs(n, 3 * n + 2), common);
+        limbs expected = euclid_gcd(a, b);
+        ASSERT_EQ(mpa::number_theory::gcd(a, b), expected) << "n = " << n;
+        ASSERT_EQ(mpa::number_theory::gcd(b, a), expected) << "n = " << n;
+        ASSERT_EQ(mpa::number_theory::gcd(a, a), a);
+    }
+}
+
+TEST(NumberTheoryTest, GcdConsecutiveFibonacci) {
+    // Consecutive Fibonacci numbers are coprime and take the longest
+    // quotient sequence (all ones).
+    limbs f0 = {1}, f1 = {1};
+    for (int i = 0; i < 20000; ++i) {
+        limbs f2 = mpa::natural::add(f0, f1);
+        f0 = std::move(f1);
+        f1 = std::move(f2);
+    }
+    ASSERT_EQ(mpa::number_theory::gcd(f0, f1), limbs{1});
+    mpa::number_theory::gcdext_result r = mpa::number_theory::gcdext(f1, f0);
+    ASSERT_EQ(r.g, limbs{1});
+}
+
+// --- Test Cases for mpa::number_theory::gcdext ---
+TEST(NumberTheoryTest, GcdextBezoutIdentity) {
+    for (mpa::usize n : GCD_SIZES) {
+        for (mpa::usize m : {n, n / 2 + 1}) {
+            limbs common = random_limbs(2, n + m);
+            limbs a = mpa::natural::mul(random_limbs(n, 5 * n + m), common);
+            limbs b = mpa::natural::mul(random_limbs(m, 7 * m + n), common);
+            mpa::number_theory::gcdext_result r = mpa::number_theory::gcdext(a, b);
+            ASSERT_EQ(r.g, euclid_gcd(a, b)) << "n = " << n << ", m = " << m;
+            ASSERT_NE(r.s_negative, r.t_negative);
+
+            // a s + b t = g, with the negative term moved across.
+            limbs as = mpa::natural::mul(a, r.s);
+            limbs bt = mpa::natural::mul(b, r.t);
+            if (r.s_negative) std::swap(as, bt);
+            ASSERT_EQ(mpa::natural::sub(as, bt), r.g) << "n = " << n << ", m = " << m;
+
+            limbs q, rem;
+            mpa::natural::divmod(b, r.g, q, rem);
+            ASSERT_LE(mpa::natural::compare(r.s, q), 0);
+            mpa::natural::divmod(a, r.g, q, rem);
+            ASSERT_LE(mpa::natural::compare(r.t, q), 0);
+        }
+    }
+}
+
+TEST(NumberTheoryTest, GcdextZeroOperands) {
+    mpa::number_theory::gcdext_result r = mpa::number_theory::gcdext({7}, {});
+    ASSERT_EQ(r.g, limbs{7});
+    ASSERT_EQ(r.s, limbs{1});
+    ASSERT_TRUE(r.t.empty());
+    r = mpa::number_theory::gcdext({}, {7});
+    ASSERT_EQ(r.g, limbs{7});
+    ASSERT_TRUE(r.s.empty());
+    ASSERT_EQ(r.t, limbs{1});
+}
+
+// --- Test Cases for mpa::number_theory::modinv ---
+TEST(NumberTheoryTest, ModinvSingleLimb) {
+    ASSERT_EQ(mpa::number_theory::modinv({3}, {7}), limbs{5});
+    ASSERT_EQ(mpa::number_theory::modinv({10}, {7}), limbs{5});
+    ASSERT_TRUE(mpa::number_theory::modinv({5}, {1}).empty());
+    const mpa::u64 p = 0xFFFFFFFFFFFFFFC5ULL; // Largest 64-bit prime
+    limbs inverse = mpa::number_theory::modinv({12345}, {p});
+    ASSERT_EQ(mod(mpa::natural::mul({12345}, inverse), {p}), limbs{1});
+}
+
+TEST(NumberTheoryTest, ModinvMultiLimb) {
+    for (mpa::usize n : GCD_SIZES) {
+        limbs m = random_limbs(n, 11 * n);
+        m[0] |= 1; // Odd modulus
+        limbs a = random_limbs(n + 1, 13 * n);
+        if (euclid_gcd(a, m) != limbs{1}) continue;
+        limbs inverse = mpa::number_theory::modinv(a, m);
+        ASSERT_LT(mpa::natural::compare(inverse, m), 0);
+        ASSERT_EQ(mod(mpa::natural::mul(a, inverse), m), limbs{1}) << "n = " << n;
+    }
+}
+
+TEST(NumberTheoryTest, ModinvErrors) {
+    ASSERT_THROW(mpa::number_theory::modinv({3}, {}), mpa::exception::division_by_zero);
+    ASSERT_THROW(mpa::number_theory::modinv({6}, {9}), mpa::exception::not_invertible);
+    limbs m = random_limbs(60, 1);
+    ASSERT_THROW(mpa::number_theory::modinv(mpa::natural::mul(m, {3}), mpa::natural::mul(m, {5})),
+                 mpa::exception::not_invertible);
+}
+
+// --- Test Cases for mpa::number_theory::sqrtrem ---
+static void check_sqrtrem(const limbs &a) {
+    mpa::number_theory::root_result r = mpa::number_theory::sqrtrem(a);
+    limbs back = mpa::natural::mul(r.root, r.root);
+    mpa::natural::add_to(back, r.remainder);
+    ASSERT_EQ(back, a);
+    // remainder <= 2 s, i.e. (s + 1)^2 > a
+    ASSERT_LE(mpa::natural::compare(r.remainder, mpa::natural::shift_left(r.root, 1)), 0);
+}
+
+TEST(NumberTheoryTest, SqrtremSmallValues) {
+    ASSERT_TRUE(mpa::number_theory::sqrtrem({}).root.empty());
+    ASSERT_EQ(mpa::number_theory::sqrtrem({99}).root, limbs{9});
+    ASSERT_EQ(mpa::number_theory::sqrtrem({99}).remainder, limbs{18});
+    ASSERT_EQ(mpa::number_theory::sqrtrem({0, 1}).root, limbs{1ULL << 32});
+    check_sqrtrem({~0ULL, ~0ULL});
+}
+
+TEST(NumberTheoryTest, SqrtremRandomAndSquares) {
+    for (mpa::usize n : {1u, 2u, 3u, 4u, 5u, 17u, 64u, 200u, 513u}) {
+        limbs a = random_limbs(n, n);
+        check_sqrtrem(a);
+        check_sqrtrem(mpa::natural::shift_right(a, 1));
+        limbs square = mpa::natural::mul(a, a);
+        mpa::number_theory::root_result r = mpa::number_theory::sqrtrem(square);
+        ASSERT_EQ(r.root, a);
+        ASSERT_TRUE(r.remainder.empty());
+        check_sqrtrem(mpa::natural::sub(square, {1}));
+    }
+}
+
+// --- Test Cases for mpa::number_theory::rootrem ---
+static void check_rootrem(const limbs &a, mpa::u64 k) {
+    mpa::number_theory::root_result r = mpa::number_theory::rootrem(a, k);
+    limbs back = mpa::natural::pow(r.root, k);
+    mpa::natural::add_to(back, r.remainder);
+    ASSERT_EQ(back, a) << "k = " << k;
+    ASSERT_GT(mpa::natural::compare(mpa::natural::pow(mpa::natural::add(r.root, {1}), k), a), 0) << "k = " << k;
+}
+
+TEST(NumberTheoryTest, RootremRandomAndPowers) {
+    for (mpa::u64 k : {1u, 2u, 3u, 5u, 7u, 64u, 1000u}) {
+        for (mpa::usize n : {1u, 2u, 9u, 40u}) {
+            limbs base = random_limbs(n, n + k);
+            check_rootrem(random_limbs(n * 3, n * k), k);
+            limbs power = mpa::natural::pow(base, k);
+            if (k <= 7) {
+                mpa::number_theory::root_result r = mpa::number_theory::rootrem(power, k);
+                ASSERT_EQ(r.root, base) << "k = " << k;
+                ASSERT_TRUE(r.remainder.empty());
+                check_rootrem(mpa::natural::sub(power, {1}), k);
+            }
+        }
+    }
+}
+
+TEST(NumberTheoryTest, RootremEdgeCases) {
+    ASSERT_THROW(mpa::number_theory::rootrem({8}, 0), mpa::exception::invalid_argument);
+    ASSERT_TRUE(mpa::number_theory::rootrem({}, 3).root.empty());
+    ASSERT_EQ(mpa::number_theory::rootrem({8}, 3).root, limbs{2});
+    ASSERT_EQ(mpa::number_theory::rootrem({7}, 3).root, limbs{1});
+    ASSERT_EQ(mpa::number_theory::rootrem({7}, 3).remainder, limbs{6});
+}
+
+// Main function to run all tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,164 @@
+#include <cmath>  // For std::ldexp, std::fabs, std::isnan
+#include <limits> // For std::numeric_limits
+#include <vector> // For std::vector
+
+#include "gtest/gtest.h"    // The Google Test framework
+#include "mpa/exceptions.h" // For mpa::exception::invalid_round_mode
+#include "mpa/round.h"      // For mpa::round::mode
+#include "mpa/sum.h"        // Summation function declarations
+#include "mpa/types.h"      // For f32, f64 types
+
+using mpa::round::mode;
+
+// Deterministic, wide-ranging input with heavy cancellation.
+static std::vector<mpa::f64> make_input(mpa::usize n) {
+    std::vector<mpa::f64> v(n);
+    mpa::u64 state = 0x9E3779B97F4A7C15ULL;
+    for (mpa::usize i = 0; i < n; ++i) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        mpa::f64 mantissa = static_cast<mpa::f64>(state >> 11) / 9007199254740992.0;
+        int exponent = static_cast<int>((state >> 3) % 80) - 40;
+        v[i] = std::ldexp((state & 1) ? -mantissa : mantissa, exponent);
+    }
+    return v;
+}
+
+// --- Test Cases for compensated and pairwise summation ---
+TEST(SumTest, EmptyInput) {
+    ASSERT_EQ(mpa::sum::kahan<mpa::f64>(nullptr, 0), 0.0);
+    ASSERT_EQ(mpa::sum::neumaier<mpa::f64>(nullptr, 0), 0.0);
+    ASSERT_EQ(mpa::sum::pairwise<mpa::f64>(nullptr, 0), 0.0);
+    ASSERT_EQ(mpa::sum::exact<mpa::f64>(nullptr, 0), 0.0);
+    ASSERT_EQ(mpa::sum::exact_dot<mpa::f64>(nullptr, nullptr, 0), 0.0);
+}
+
+TEST(SumTest, NeumaierHandlesLargeAddends) {
+    const mpa::f64 data[] = {1.0, 1e100, 1.0, -1e100};
+    ASSERT_DOUBLE_EQ(mpa::sum::neumaier(data, 4), 2.0);
+}
+
+TEST(SumTest, CompensatedBeatsNaiveF32) {
+    std::vector<mpa::f32> data(1 << 20, 0.1f);
+    mpa::f64 expected = static_cast<mpa::f64>(0.1f) * data.size();
+    ASSERT_NEAR(mpa::sum::kahan(data.data(), data.size()), expected, 1e-2);
+    ASSERT_NEAR(mpa::sum::neumaier(data.data(), data.size()), expected, 1e-2);
+    ASSERT_NEAR(mpa::sum::pairwise(data.data(), data.size()), expected, 1e-1);
+}
+
+TEST(SumTest, CompensatedMatchesExactF64) {
+    std::vector<mpa::f64> data = make_input(10007);
+    mpa::f64 reference = mpa::sum::exact(data.data(), data.size());
+    const mpa::f64 tolerance = std::fabs(reference) * 1e-12;
+    ASSERT_NEAR(mpa::sum::kahan(data.data(), data.size()), reference, tolerance);
+    ASSERT_NEAR(mpa::sum::neumaier(data.data(), data.size()), reference, tolerance);
+    ASSERT_NEAR(mpa::sum::pairwise(data.data(), data.size()), reference, tolerance);
+}
+
+// --- Test Cases for mpa::sum::exact ---
+TEST(SumTest, ExactCancellation) {
+    const mpa::f64 data[] = {1e100, 1.0, -1e100, 1e-100, -1e-100};
+    ASSERT_EQ(mpa::sum::exact(data, 5), 1.0);
+}
+
+TEST(SumTest, ExactIsOrderIndependent) {
+    std::vector<mpa::f64> data = make_input(4099);
+    mpa::f64 forward = mpa::sum::exact(data.data(), data.size());
+    std::vector<mpa::f64> reversed(data.rbegin(), data.rend());
+    ASSERT_EQ(mpa::sum::exact(reversed.data(), reversed.size()), forward);
+}
+
+TEST(SumTest, ExactRoundingModesF64) {
+    const mpa::f64 up = 1.0 + std::ldexp(1.0, -52);
+    const mpa::f64 tie[] = {1.0, std::ldexp(1.0, -53)};
+    ASSERT_EQ(mpa::sum::exact(tie, 2, mode::nearest), up);
+    ASSERT_EQ(mpa::sum::exact(tie, 2, mode::towards_even), 1.0);
+    ASSERT_EQ(mpa::sum::exact(tie, 2, mode::towards_odd), up);
+    ASSERT_EQ(mpa::sum::exact(tie, 2, mode::towards_zero), 1.0);
+    ASSERT_EQ(mpa::sum::exact(tie, 2, mode::away_from_zero), up);
+    ASSERT_EQ(mpa::sum::exact(tie, 2, mode::ceil), up);
+    ASSERT_EQ(mpa::sum::exact(tie, 2, mode::floor), 1.0);
+
+    const mpa::f64 negative_tie[] = {-1.0, -std::ldexp(1.0, -53)};
+    ASSERT_EQ(mpa::sum::exact(negative_tie, 2, mode::ceil), -1.0);
+    ASSERT_EQ(mpa::sum::exact(negative_tie, 2, mode::floor), -up);
+
+    // Ten copies of 0.1 sum to slightly more than 1.
+    std::vector<mpa::f64> tenths(10, 0.1);
+    ASSERT_EQ(mpa::sum::exact(tenths.data(), 10, mode::towards_even), 1.0);
+    ASSERT_EQ(mpa::sum::exact(tenths.data(), 10, mode::floor), 1.0);
+    ASSERT_EQ(mpa::sum::exact(tenths.data(), 10, mode::ceil), up);
+}
+
+TEST(SumTest, ExactRoundingModesF32) {
+    const mpa::f32 up = 1.0f + std::ldexp(1.0f, -23);
+    const mpa::f32 tie[] = {1.0f, std::ldexp(1.0f, -24)};
+    ASSERT_EQ(mpa::sum::exact(tie, 2, mode::towards_even), 1.0f);
+    ASSERT_EQ(mpa::sum::exact(tie, 2, mode::towards_odd), up);
+    ASSERT_EQ(mpa::sum::exact(tie, 2, mode::ceil), up);
+    ASSERT_EQ(mpa::sum::exact(tie, 2, mode::towards_zero), 1.0f);
+}
+
+TEST(SumTest, ExactSubnormalsAndOverflow) {
+    const mpa::f64 tiny = std::numeric_limits<mpa::f64>::denorm_min();
+    const mpa::f64 huge = std::numeric_limits<mpa::f64>::max();
+    const mpa::f64 tinies[] = {tiny, tiny, tiny};
+    ASSERT_EQ(mpa::sum::exact(tinies, 3), 3 * tiny);
+
+    const mpa::f64 no_overflow[] = {huge, huge, -huge};
+    ASSERT_EQ(mpa::sum::exact(no_overflow, 3), huge);
+
+    const mpa::f64 overflow[] = {huge, huge};
+    ASSERT_EQ(mpa::sum::exact(overflow, 2), std::numeric_limits<mpa::f64>::infinity());
+    ASSERT_EQ(mpa::sum::exact(overflow, 2, mode::towards_zero), huge);
+}
+
+TEST(SumTest, ExactSpecialValues) {
+    const mpa::f64 inf = std::numeric_limits<mpa::f64>::infinity();
+    const mpa::f64 opposite[] = {inf, 1.0, -inf};
+    ASSERT_TRUE(std::isnan(mpa::sum::exact(opposite, 3)));
+    const mpa::f64 same[] = {inf, 1.0, inf};
+    ASSERT_EQ(mpa::sum::exact(same, 3), inf);
+}
+
+TEST(SumTest, InvalidRoundModeThrows) {
+    const mpa::f64 data[] = {1.0};
+    ASSERT_THROW(mpa::sum::exact(data, 1, static_cast<mode>(42)), mpa::exception::invalid_round_mode);
+}
+
+// --- Test Cases for mpa::sum::exact_dot ---
+TEST(SumTest, ExactDotIsExact) {
+    const mpa::f64 big = std::ldexp(1.0, 600);
+    const mpa::f64 x[] = {big, 1.0, big};
+    const mpa::f64 y[] = {big, 3.0, -big};
+    ASSERT_EQ(mpa::sum::exact_dot(x, y, 3), 3.0);
+
+    // The product 2^-1200 is below the subnormal range; only ceil rounds it up.
+    const mpa::f64 small[] = {std::ldexp(1.0, -600)};
+    ASSERT_EQ(mpa::sum::exact_dot(small, small, 1), 0.0);
+    ASSERT_EQ(mpa::sum::exact_dot(small, small, 1, mode::ceil), std::numeric_limits<mpa::f64>::denorm_min());
+}
+
+TEST(SumTest, ExactDotF32) {
+    const mpa::f32 x[] = {1e20f, 1.5f, -1e20f};
+    const mpa::f32 y[] = {1e18f, 2.0f, 1e18f};
+    ASSERT_EQ(mpa::sum::exact_dot(x, y, 3), 3.0f);
+}
+
+// --- Test Cases for the parallel kernels ---
+TEST(SumTest, ParallelIsReproducible) {
+    std::vector<mpa::f64> data = make_input(3 * mpa::sum::PARALLEL_THRESHOLD * 4 + 17);
+    const mpa::f64 pairwise = mpa::sum::pairwise(data.data(), data.size());
+    const mpa::f64 exact = mpa::sum::exact(data.data(), data.size(), mode::floor);
+    const mpa::f64 dot = mpa::sum::exact_dot(data.data(), data.data(), data.size());
+    for (unsigned threads : {1u, 2u, 3u, 7u, 16u}) {
+        ASSERT_EQ(mpa::sum::parallel_pairwise(data.data(), data.size(), threads), pairwise);
+        ASSERT_EQ(mpa::sum::parallel_exact(data.data(), data.size(), mode::floor, threads), exact);
+        ASSERT_EQ(mpa::sum::parallel_exact_dot(data.data(), data.data(), data.size(), mode::towards_even, threads), dot);
+    }
+}
+
+// Main function to run all tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}